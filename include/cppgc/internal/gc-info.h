@@ -145,8 +145,17 @@ struct GCInfoTrait final {
     static std::atomic<GCInfoIndex>
         registered_index;  // Uses zero initialization.
     const GCInfoIndex index = registered_index.load(std::memory_order_acquire);
-    return index ? index
-                 : EnsureGCInfoIndexTrait::EnsureIndex<T>(registered_index);
+    if (V8_UNLIKELY(!index)) return EnsureIndexSlow(registered_index);
+    return index;
+  }
+
+ private:
+  // Registration happens once per type. The fast path above is the same load
+  // and branch either way; keeping the registration out of line only saves
+  // materializing the callbacks at every inlined call site.
+  V8_NOINLINE static GCInfoIndex EnsureIndexSlow(
+      std::atomic<GCInfoIndex>& registered_index) {
+    return EnsureGCInfoIndexTrait::EnsureIndex<T>(registered_index);
   }
 };
 
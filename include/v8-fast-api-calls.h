@@ -247,6 +247,8 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    kSeqOneByteString,
+    kSeqTwoByteString,
     kApiObject,  // This will be deprecated once all users have
                  // migrated from v8::ApiObject to v8::Local<v8::Value>.
     kAny,        // This is added to enable untyped representation of fast
@@ -377,6 +379,35 @@ struct FastApiArrayBuffer {
   size_t byte_length;
 };
 
+// A view of the characters of a flat, sequential one-byte string, passed to a
+// fast callback that takes a `const FastOneByteString&` argument. The
+// characters live on the V8 heap and are only valid until the callback
+// returns; they are not null-terminated. Other strings (e.g. cons or sliced
+// strings) and non-string values are passed to the slow callback instead.
+//
+// A fast callback may also return a `const FastOneByteString*`, which V8 then
+// copies into a new string after the callback has returned, possibly after a
+// garbage collection. Both the struct and its characters must therefore stay
+// valid after the callback returns, e.g. by keeping them in thread-local
+// storage, and the characters must not point into the V8 heap; in particular
+// the characters of a FastOneByteString argument must not be returned.
+// Returning nullptr, or a string longer than kMaxReturnLength characters,
+// falls back to the slow callback, with the same idempotency requirements as
+// for FastApiCallbackOptions::fallback.
+struct FastOneByteString {
+  static constexpr uint32_t kMaxReturnLength = 1024;
+
+  const char* data;
+  uint32_t length;
+};
+
+// Like FastOneByteString, for flat, sequential two-byte strings. Only
+// supported as an argument type.
+struct FastTwoByteString {
+  const uint16_t* data;
+  uint32_t length;
+};
+
 class V8_EXPORT CFunctionInfo {
  public:
   // Construct a struct to hold a CFunction's type information.
@@ -435,6 +466,8 @@ struct AnyCType {
     const FastApiTypedArray<uint64_t>* uint64_ta_value;
     const FastApiTypedArray<float>* float_ta_value;
     const FastApiTypedArray<double>* double_ta_value;
+    const FastOneByteString* one_byte_string_value;
+    const FastTwoByteString* two_byte_string_value;
     FastApiCallbackOptions* options_value;
   };
 };
@@ -482,11 +515,10 @@ class V8_EXPORT CFunction {
         }
         diff_index = i;
 
-        // We only support overload resolution between sequence types.
-        if (ArgumentInfo(i).GetSequenceType() ==
-                CTypeInfo::SequenceType::kScalar ||
-            other->ArgumentInfo(i).GetSequenceType() ==
-                CTypeInfo::SequenceType::kScalar) {
+        // We only support overload resolution between sequence types, or
+        // between a sequence type and a v8::Value that takes all other values.
+        if (!IsOverloadableArgument(ArgumentInfo(i)) ||
+            !IsOverloadableArgument(other->ArgumentInfo(i))) {
           return OverloadResolution::kImpossible;
         }
       }
@@ -516,6 +548,11 @@ class V8_EXPORT CFunction {
   CFunction(const void* address, const CFunctionInfo* type_info);
 
  private:
+  static bool IsOverloadableArgument(const CTypeInfo& type_info) {
+    return type_info.GetSequenceType() != CTypeInfo::SequenceType::kScalar ||
+           type_info.GetType() == CTypeInfo::Type::kV8Value;
+  }
+
   const void* address_;
   const CFunctionInfo* type_info_;
 
@@ -605,9 +642,10 @@ class CFunctionInfoImpl : public CFunctionInfo {
                       kReturnType == CTypeInfo::Type::kUint32 ||
                       kReturnType == CTypeInfo::Type::kFloat32 ||
                       kReturnType == CTypeInfo::Type::kFloat64 ||
+                      kReturnType == CTypeInfo::Type::kSeqOneByteString ||
                       kReturnType == CTypeInfo::Type::kAny,
-                  "64-bit int and api object values are not currently "
-                  "supported return types.");
+                  "64-bit int, two-byte string and api object values are not "
+                  "currently supported return types.");
   }
 
  private:
@@ -693,6 +731,15 @@ TYPED_ARRAY_C_TYPES(SPECIALIZE_GET_TYPE_INFO_HELPER_FOR_TA)
 
 #undef TYPED_ARRAY_C_TYPES
 
+#define STRING_C_TYPES(V)                        \
+  V(const FastOneByteString&, kSeqOneByteString) \
+  V(const FastOneByteString*, kSeqOneByteString) \
+  V(const FastTwoByteString&, kSeqTwoByteString)
+
+STRING_C_TYPES(SPECIALIZE_GET_TYPE_INFO_HELPER_FOR)
+
+#undef STRING_C_TYPES
+
 template <>
 struct TypeInfoHelper<v8::Local<v8::Array>> {
   static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
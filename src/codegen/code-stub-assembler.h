@@ -2674,6 +2674,11 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
         ExternalReference::address_of_builtin_subclassing_flag());
   }
 
+  TNode<BoolT> HasMegamorphicInliningFlag() {
+    return LoadRuntimeFlag(
+        ExternalReference::address_of_megamorphic_inlining_flag());
+  }
+
   TNode<BoolT> HasSharedStringTableFlag() {
     return LoadRuntimeFlag(
         ExternalReference::address_of_shared_string_table_flag());
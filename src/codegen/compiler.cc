@@ -34,6 +34,8 @@
 #include "src/execution/isolate-inl.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate.h"
+#include "src/execution/tiering-manager.h"
+#include "src/execution/tiering-profile.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/handles.h"
 #include "src/handles/maybe-handles.h"
@@ -99,6 +101,19 @@ void ResetProfilerTicks(JSFunction function, BytecodeOffset osr_offset) {
   }
 }
 
+void ResetDeoptCountIfStable(JSFunction function, BytecodeOffset osr_offset) {
+  if (IsOSR(osr_offset)) return;
+  // If the previous optimized code didn't deoptimize eagerly, it was stable
+  // and the function is no longer considered to be in a deoptimization loop.
+  FeedbackVector vector = function.feedback_vector();
+  if (!vector.deoptimized_since_optimization()) {
+    vector.set_deopt_count(0);
+    vector.set_last_deopt_bytecode_offset(
+        FeedbackVector::kNoDeoptBytecodeOffset);
+  }
+  vector.set_deoptimized_since_optimization(false);
+}
+
 class CompilerTracer : public AllStatic {
  public:
   static void TracePrepareJob(Isolate* isolate, OptimizedCompilationInfo* info,
@@ -967,6 +982,23 @@ class OptimizedCodeCache : public AllStatic {
   }
 };
 
+// Remembers that the function was optimized by TurboFan. The hint is part of
+// the SharedFunctionInfo and thus survives code caching, so that processes
+// consuming the code cache can tier the function up early. The function is
+// also added to the tiering profile, if one is written.
+void RecordOptimizationHint(Isolate* isolate,
+                            OptimizedCompilationInfo* compilation_info) {
+  if (V8_LIKELY(!FLAG_code_cache_optimization_hints &&
+                FLAG_tiering_profile_output == nullptr)) {
+    return;
+  }
+  if (compilation_info->code_kind() != CodeKind::TURBOFAN) return;
+  compilation_info->shared_info()->set_has_optimization_hint(true);
+  if (TieringProfile* profile = isolate->tiering_profile()) {
+    profile->RecordOptimized(*compilation_info->shared_info());
+  }
+}
+
 // Runs PrepareJob in the proper compilation & canonical scopes. Handles will be
 // allocated in a persistent handle scope that is detached and handed off to the
 // {compilation_info} after PrepareJob.
@@ -1015,6 +1047,7 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
   job->RecordCompilationStats(ConcurrencyMode::kSynchronous, isolate);
   DCHECK(!isolate->has_pending_exception());
   OptimizedCodeCache::Insert(compilation_info);
+  RecordOptimizationHint(isolate, compilation_info);
   job->RecordFunctionCompilation(LogEventListener::LAZY_COMPILE_TAG, isolate);
   return true;
 }
@@ -1114,6 +1147,10 @@ MaybeHandle<CodeT> CompileTurbofan(Isolate* isolate,
   if (result_behavior == CompileResultBehavior::kDiscardForTesting) {
     job->compilation_info()->set_discard_result_for_testing();
   }
+  if (TieringManager::UseReducedTurbofanPipeline(*function,
+                                                 !osr_offset.IsNone())) {
+    job->compilation_info()->set_reduced_optimization();
+  }
 
   // Prepare the job and launch concurrent compilation, or compile now.
   if (IsConcurrent(mode)) {
@@ -1257,6 +1294,7 @@ MaybeHandle<CodeT> GetOrCompileOptimized(
   DCHECK(shared->is_compiled());
 
   ResetProfilerTicks(*function, osr_offset);
+  ResetDeoptCountIfStable(*function, osr_offset);
 
   if (code_kind == CodeKind::TURBOFAN) {
     return CompileTurbofan(isolate, function, shared, mode, osr_offset,
@@ -3450,6 +3488,7 @@ bool Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
 
   if (V8_LIKELY(use_result)) {
     ResetProfilerTicks(*function, osr_offset);
+    ResetDeoptCountIfStable(*function, osr_offset);
   }
 
   DCHECK(!shared->HasBreakInfo());
@@ -3469,6 +3508,7 @@ bool Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
       if (V8_LIKELY(use_result)) {
         ResetTieringState(*function, osr_offset);
         OptimizedCodeCache::Insert(compilation_info);
+        RecordOptimizationHint(isolate, compilation_info);
         CompilerTracer::TraceCompletedJob(isolate, compilation_info);
         if (IsOSR(osr_offset)) {
           if (FLAG_trace_osr) {
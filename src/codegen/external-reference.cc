@@ -554,6 +554,10 @@ ExternalReference ExternalReference::address_of_builtin_subclassing_flag() {
   return ExternalReference(&FLAG_builtin_subclassing);
 }
 
+ExternalReference ExternalReference::address_of_megamorphic_inlining_flag() {
+  return ExternalReference(&FLAG_megamorphic_inlining);
+}
+
 ExternalReference ExternalReference::address_of_runtime_stats_flag() {
   return ExternalReference(&TracingFlags::runtime_stats);
 }
@@ -10,6 +10,7 @@
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate.h"
 #include "src/handles/handles-inl.h"
+#include "src/heap/heap-inl.h"
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
 #include "src/init/v8.h"
@@ -81,12 +82,53 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
   DeleteArray(input_queue_);
 }
 
+namespace {
+
+// The bytecode size is a cheap estimate of how long the job takes to execute.
+int EstimatedJobSize(TurbofanCompilationJob* job) {
+  OptimizedCompilationInfo* info = job->compilation_info();
+  if (!info->has_bytecode_array()) return 0;
+  return info->bytecode_array()->length();
+}
+
+}  // namespace
+
+int OptimizingCompileDispatcher::NextInputIndex() {
+  if (!largest_first_) return 0;
+  // OSR jobs come first since the function is already running a hot loop.
+  // Otherwise, start the largest job first: a single TurboFan job can't be
+  // spread across threads, so starting it early lets it overlap with the
+  // smaller jobs on other threads instead of finishing last on its own.
+  // Equally ranked jobs keep their FIFO order.
+  int best = 0;
+  TurbofanCompilationJob* best_job = input_queue_[InputQueueIndex(0)];
+  bool best_is_osr = best_job->compilation_info()->is_osr();
+  int best_size = EstimatedJobSize(best_job);
+  for (int i = 1; i < input_queue_length_; i++) {
+    TurbofanCompilationJob* job = input_queue_[InputQueueIndex(i)];
+    bool is_osr = job->compilation_info()->is_osr();
+    if (best_is_osr && !is_osr) continue;
+    int size = EstimatedJobSize(job);
+    if ((is_osr && !best_is_osr) || size > best_size) {
+      best = i;
+      best_is_osr = is_osr;
+      best_size = size;
+    }
+  }
+  return best;
+}
+
 TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return nullptr;
-  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  int index = NextInputIndex();
+  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(index)];
   DCHECK_NOT_NULL(job);
+  // Close the gap so that the remaining jobs stay in FIFO order.
+  for (int i = index; i > 0; i--) {
+    input_queue_[InputQueueIndex(i)] = input_queue_[InputQueueIndex(i - 1)];
+  }
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
   return job;
@@ -180,6 +222,10 @@ void OptimizingCompileDispatcher::Stop() {
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
+  // Jobs are finalized in a batch. Keep code pages that are written to during
+  // finalization writable until all jobs are installed, so that permissions
+  // are only switched back to RX once per batch instead of once per job.
+  CodePageCollectionMemoryModificationScope batch_install(isolate_->heap());
 
   for (;;) {
     std::unique_ptr<TurbofanCompilationJob> job;
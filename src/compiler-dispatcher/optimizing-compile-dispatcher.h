@@ -14,6 +14,7 @@
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
 namespace internal {
@@ -31,7 +32,8 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         input_queue_length_(0),
         input_queue_shift_(0),
         ref_count_(0),
-        recompilation_delay_(FLAG_concurrent_recompilation_delay) {
+        recompilation_delay_(FLAG_concurrent_recompilation_delay),
+        largest_first_(FLAG_concurrent_recompilation_largest_first) {
     input_queue_ = NewArray<TurbofanCompilationJob*>(input_queue_capacity_);
   }
 
@@ -74,6 +76,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(TurbofanCompilationJob* job, LocalIsolate* local_isolate);
   TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate);
+  // Returns the position in the input queue of the job to compile next.
+  // Requires {input_queue_mutex_} to be held.
+  int NextInputIndex();
 
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
@@ -108,7 +113,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // is not safe to access them directly.
   int recompilation_delay_;
 
+  // Copy of FLAG_concurrent_recompilation_largest_first, for the same reason.
+  bool largest_first_;
+
   bool finalize_ = true;
+
+  FRIEND_TEST(OptimizingCompileDispatcherTest, NextInputOrder);
 };
 }  // namespace internal
 }  // namespace v8
@@ -24,6 +24,15 @@ void InstructionScheduler::SchedulingQueueBase::AddNode(
   nodes_.insert(it, node);
 }
 
+int InstructionScheduler::SchedulingQueueBase::EarliestStartCycle() const {
+  DCHECK(!IsEmpty());
+  int start_cycle = nodes_.front()->start_cycle();
+  for (ScheduleGraphNode* node : nodes_) {
+    start_cycle = std::min(start_cycle, node->start_cycle());
+  }
+  return start_cycle;
+}
+
 InstructionScheduler::ScheduleGraphNode*
 InstructionScheduler::CriticalPathFirstQueue::PopBestCandidate(int cycle) {
   DCHECK(!IsEmpty());
@@ -99,12 +108,16 @@ void InstructionScheduler::StartBlock(RpoNumber rpo) {
 }
 
 void InstructionScheduler::EndBlock(RpoNumber rpo) {
+  ScheduleRegion();
+  sequence()->EndBlock(rpo);
+}
+
+void InstructionScheduler::ScheduleRegion() {
   if (FLAG_turbo_stress_instruction_scheduling) {
     Schedule<StressSchedulerQueue>();
   } else {
     Schedule<CriticalPathFirstQueue>();
   }
-  sequence()->EndBlock(rpo);
 }
 
 void InstructionScheduler::AddTerminator(Instruction* instr) {
@@ -119,15 +132,20 @@ void InstructionScheduler::AddTerminator(Instruction* instr) {
 
 void InstructionScheduler::AddInstruction(Instruction* instr) {
   if (IsBarrier(instr)) {
-    if (FLAG_turbo_stress_instruction_scheduling) {
-      Schedule<StressSchedulerQueue>();
-    } else {
-      Schedule<CriticalPathFirstQueue>();
-    }
+    ScheduleRegion();
     sequence()->AddInstruction(instr);
     return;
   }
 
+  // Building the graph and scheduling it is quadratic in the number of
+  // instructions, so large blocks are scheduled in windows of a bounded size.
+  // Like at barriers, nothing is reordered across the end of a window.
+  if (FLAG_turbo_instruction_scheduling_window > 0 &&
+      graph_.size() >=
+          static_cast<size_t>(FLAG_turbo_instruction_scheduling_window)) {
+    ScheduleRegion();
+  }
+
   ScheduleGraphNode* new_node = zone()->New<ScheduleGraphNode>(zone(), instr);
 
   // We should not have branches in the middle of a block.
@@ -239,9 +257,12 @@ void InstructionScheduler::Schedule() {
           ready_list.AddNode(successor);
         }
       }
+      cycle++;
+    } else {
+      // Nothing is ready before the first operands become available, so skip
+      // the idle cycles behind long-latency instructions.
+      cycle = ready_list.EarliestStartCycle();
     }
-
-    cycle++;
   }
 
   // Reset own state.
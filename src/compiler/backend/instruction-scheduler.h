@@ -112,6 +112,9 @@ class InstructionScheduler final : public ZoneObject {
 
     bool IsEmpty() const { return nodes_.empty(); }
 
+    // The first cycle at which one of the nodes can be scheduled.
+    int EarliestStartCycle() const;
+
    protected:
     InstructionScheduler* scheduler_;
     ZoneLinkedList<ScheduleGraphNode*> nodes_;
@@ -150,6 +153,10 @@ class InstructionScheduler final : public ZoneObject {
   template <typename QueueType>
   void Schedule();
 
+  // Schedule the instructions added so far, with the queue type selected by
+  // the flags.
+  void ScheduleRegion();
+
   // Return the scheduling properties of the given instruction.
   V8_EXPORT_PRIVATE int GetInstructionFlags(const Instruction* instr) const;
   int GetTargetInstructionFlags(const Instruction* instr) const;
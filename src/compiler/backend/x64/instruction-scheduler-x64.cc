@@ -445,66 +445,139 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+namespace {
+
+// Latency of a load that hits the L1 cache.
+constexpr int kLoadLatency = 5;
+
+// Latencies of the operations themselves, not counting memory operands. They
+// follow the published measurements for recent Intel (Ice Lake and later) and
+// AMD (Zen 3 and later) cores, rounded up to the slower of the two.
+int GetOperationLatency(const Instruction* instr) {
   switch (instr->arch_opcode()) {
-    case kSSEFloat64Mul:
-      return 5;
     case kX64Imul:
     case kX64Imul32:
+    case kX64Lzcnt:
+    case kX64Lzcnt32:
+    case kX64Tzcnt:
+    case kX64Tzcnt32:
+    case kX64Popcnt:
+    case kX64Popcnt32:
+    case kSSEFloat32Cmp:
+    case kSSEFloat64Cmp:
+    case kAVXFloat32Cmp:
+    case kAVXFloat64Cmp:
+    case kSSEFloat64ExtractLowWord32:
+    case kSSEFloat64ExtractHighWord32:
+    case kSSEFloat64InsertLowWord32:
+    case kSSEFloat64InsertHighWord32:
+    case kSSEFloat64LoadLowWord32:
+    case kX64BitcastFI:
+    case kX64BitcastDL:
+    case kX64BitcastIF:
+    case kX64BitcastLD:
+    case kX64F64x2ExtractLane:
+    case kX64F64x2ReplaceLane:
+      return 3;
     case kX64ImulHigh32:
     case kX64UmulHigh32:
-    case kX64Float32Abs:
-    case kX64Float32Neg:
-    case kX64Float64Abs:
-    case kX64Float64Neg:
-    case kSSEFloat32Cmp:
     case kSSEFloat32Add:
     case kSSEFloat32Sub:
-    case kSSEFloat64Cmp:
+    case kSSEFloat32Mul:
     case kSSEFloat64Add:
     case kSSEFloat64Sub:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kAVXFloat64Mul:
+    case kSSEFloat32Max:
+    case kSSEFloat32Min:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
-      return 3;
-    case kSSEFloat32Mul:
+    case kSSEFloat64SilenceNaN:
+    case kX64F64x2Add:
+    case kX64F64x2Sub:
+    case kX64F64x2Mul:
+    case kX64F64x2Min:
+    case kX64F64x2Max:
+    case kX64F64x2Eq:
+    case kX64F64x2Ne:
+    case kX64F64x2Lt:
+    case kX64F64x2Le:
+    case kX64F64x2Qfma:
+    case kX64F64x2Qfms:
+      return 4;
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
-    case kSSEFloat32Round:
-    case kSSEFloat64Round:
+    case kSSEInt32ToFloat32:
+    case kSSEInt32ToFloat64:
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kSSEUint32ToFloat32:
+    case kSSEUint32ToFloat64:
+    case kX64Cvttps2dq:
+    case kX64Cvttpd2dq:
+      return 5;
     case kSSEFloat32ToInt32:
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
-    case kX64Idiv:
-      return 49;
-    case kX64Idiv32:
-      return 35;
-    case kX64Udiv:
-      return 38;
-    case kX64Udiv32:
-      return 26;
-    case kSSEFloat32Div:
-    case kSSEFloat64Div:
-    case kSSEFloat32Sqrt:
-    case kSSEFloat64Sqrt:
-      return 13;
+    case kArchTruncateDoubleToI:
+      return 6;
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return 8;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
     case kSSEFloat64ToUint64:
+    case kSSEUint64ToFloat32:
+    case kSSEUint64ToFloat64:
+      // These expand to sequences with a conditional fix-up.
       return 10;
+    case kSSEFloat32Div:
+    case kAVXFloat32Div:
+      return 11;
+    case kSSEFloat32Sqrt:
+    case kX64Udiv32:
+      return 12;
+    case kSSEFloat64Div:
+    case kAVXFloat64Div:
+    case kX64F64x2Div:
+    case kX64Idiv32:
+      return 14;
+    case kX64Udiv:
+      return 16;
+    case kSSEFloat64Sqrt:
+    case kX64F64x2Sqrt:
+    case kX64Idiv:
+      return 18;
     case kSSEFloat64Mod:
+      // An x87 fprem loop.
       return 50;
-    case kArchTruncateDoubleToI:
-      return 6;
     default:
       return 1;
   }
 }
 
+}  // namespace
+
+int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  int latency = GetOperationLatency(instr);
+  // Instructions with a memory operand (other than lea and stores) wait for
+  // the load before their result is available.
+  if (instr->addressing_mode() != kMode_None && instr->HasOutput() &&
+      instr->arch_opcode() != kX64Lea && instr->arch_opcode() != kX64Lea32) {
+    latency += kLoadLatency;
+  } else if (instr->arch_opcode() == kX64Peek) {
+    latency += kLoadLatency;
+  }
+  return latency;
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,266 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/bounds-check-elimination.h"
+
+#include "src/base/small-vector.h"
+#include "src/compiler/all-nodes.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/loop-invariant-code-motion.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/flags/flags.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_bce) PrintF(__VA_ARGS__); \
+  } while (false)
+
+namespace {
+
+bool IsLessThan(Node* node) {
+  return node->opcode() == IrOpcode::kNumberLessThan ||
+         node->opcode() == IrOpcode::kSpeculativeNumberLessThan;
+}
+
+bool IsLessThanOrEqual(Node* node) {
+  return node->opcode() == IrOpcode::kNumberLessThanOrEqual ||
+         node->opcode() == IrOpcode::kSpeculativeNumberLessThanOrEqual;
+}
+
+bool IsNonNegativeConstant(Node* node) {
+  NumberMatcher m(node);
+  return m.HasResolvedValue() && m.ResolvedValue() >= 0;
+}
+
+// If {node} computes (minuend - c) for a positive constant c, returns the
+// minuend, or nullptr otherwise.
+Node* MatchSubtractPositiveConstant(Node* node) {
+  while (node->opcode() == IrOpcode::kTypeGuard) {
+    node = NodeProperties::GetValueInput(node, 0);
+  }
+  switch (node->opcode()) {
+    case IrOpcode::kNumberSubtract:
+    case IrOpcode::kSpeculativeNumberSubtract:
+    case IrOpcode::kSpeculativeSafeIntegerSubtract: {
+      NumberMatcher m(NodeProperties::GetValueInput(node, 1));
+      if (m.HasResolvedValue() && m.ResolvedValue() > 0) {
+        return NodeProperties::GetValueInput(node, 0);
+      }
+      return nullptr;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+// If {node} computes (value + 1), returns the value, or nullptr otherwise.
+Node* MatchIncrement(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kSpeculativeNumberAdd:
+    case IrOpcode::kSpeculativeSafeIntegerAdd: {
+      NumberMatcher m(NodeProperties::GetValueInput(node, 1));
+      if (m.Is(1)) return NodeProperties::GetValueInput(node, 0);
+      return nullptr;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+// If {node} is an induction variable of {loop} that is incremented by one in
+// every iteration, returns its initial value, or nullptr otherwise.
+Node* MatchIncrementingInductionVariable(Node* node, Node* loop) {
+  if (node->opcode() != IrOpcode::kPhi || node->InputCount() != 3 ||
+      NodeProperties::GetControlInput(node) != loop ||
+      MatchIncrement(node->InputAt(1)) != node) {
+    return nullptr;
+  }
+  return node->InputAt(0);
+}
+
+}  // namespace
+
+void BoundsCheckElimination::Run() {
+  AllNodes all(tmp_zone_, jsgraph()->graph());
+  for (Node* node : all.reachable) {
+    if (node->opcode() == IrOpcode::kCheckBounds) VisitCheckBounds(node);
+  }
+}
+
+void BoundsCheckElimination::VisitCheckBounds(Node* node) {
+  CheckBoundsParameters const& params = CheckBoundsParametersOf(node->op());
+  // Such checks are guarded by an explicit branch and don't deoptimize.
+  if (params.flags() & CheckBoundsFlag::kAbortOnOutOfBounds) return;
+
+  Node* index = NodeProperties::GetValueInput(node, 0);
+  Node* length = NodeProperties::GetValueInput(node, 1);
+  if (!NodeProperties::GetType(index).Is(Type::Integral32())) return;
+  bool non_negative = NodeProperties::GetType(index).Min() >= 0;
+  // Values that {index} is known to be smaller than.
+  base::SmallVector<Node*, 4> bounds;
+
+  // A decreasing induction variable never exceeds its initial value, which
+  // is below every minuend it was computed from, e.g. a.length for
+  // (a.length - 1), or for (a.length - 1 - 1) after loop peeling.
+  if (index->opcode() == IrOpcode::kPhi && index->InputCount() == 3 &&
+      MatchSubtractPositiveConstant(index->InputAt(1)) == index) {
+    for (Node* bound = MatchSubtractPositiveConstant(index->InputAt(0));
+         bound != nullptr; bound = MatchSubtractPositiveConstant(bound)) {
+      bounds.emplace_back(bound);
+    }
+  }
+
+  // Collect facts about {index} from the branches that dominate {node} in
+  // the same loop iteration, up to the innermost loop header. If {node} is
+  // only guarded by a single (index < bound) branch, remember it as a
+  // candidate for the loop's exit test.
+  Node* loop = nullptr;
+  Node* exit_branch = nullptr;
+  int branch_count = 0;
+  Node* control = NodeProperties::GetControlInput(node);
+  while (control->op()->ControlInputCount() == 1) {
+    if (control->opcode() == IrOpcode::kIfTrue ||
+        control->opcode() == IrOpcode::kIfFalse) {
+      bool is_true = control->opcode() == IrOpcode::kIfTrue;
+      Node* branch = control->InputAt(0);
+      Node* condition = NodeProperties::GetValueInput(branch, 0);
+      Node* lhs = condition->op()->ValueInputCount() == 2
+                      ? NodeProperties::GetValueInput(condition, 0)
+                      : nullptr;
+      Node* rhs = condition->op()->ValueInputCount() == 2
+                      ? NodeProperties::GetValueInput(condition, 1)
+                      : nullptr;
+      branch_count++;
+      if (IsLessThan(condition)) {
+        if (is_true && lhs == index) {
+          bounds.emplace_back(rhs);
+          exit_branch = branch;
+        }
+        if (!is_true && lhs == index && IsNonNegativeConstant(rhs)) {
+          non_negative = true;
+        }
+      } else if (IsLessThanOrEqual(condition)) {
+        if (is_true && rhs == index && IsNonNegativeConstant(lhs)) {
+          non_negative = true;
+        }
+        if (!is_true && rhs == index) bounds.emplace_back(lhs);
+      }
+    }
+    control = NodeProperties::GetControlInput(control);
+  }
+  if (control->opcode() == IrOpcode::kLoop) loop = control;
+
+  if (!non_negative) return;
+  for (Node* bound : bounds) {
+    if (bound == length) {
+      TRACE("Eliminated #%d:CheckBounds of #%d against #%d\n", node->id(),
+            index->id(), length->id());
+      Eliminate(node);
+      return;
+    }
+  }
+  if (loop == nullptr || branch_count != 1 || exit_branch == nullptr) return;
+  if (Node* guard = GetOrCreateLoopGuard(loop, exit_branch, index, length,
+                                         node)) {
+    TRACE(
+        "Eliminated #%d:CheckBounds of #%d against #%d with #%d:CheckIf "
+        "before loop #%d\n",
+        node->id(), index->id(), length->id(), guard->id(), loop->id());
+    Eliminate(node);
+  }
+}
+
+bool BoundsCheckElimination::IsOnlyLoopExit(LoopTree::Loop* loop,
+                                            Node* branch) {
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    for (Edge edge : node->use_edges()) {
+      if (!NodeProperties::IsControlEdge(edge)) continue;
+      Node* use = edge.from();
+      if (loop_tree_->Contains(loop, use)) continue;
+      if (node == branch && use->opcode() == IrOpcode::kIfFalse) continue;
+      // Deoptimizing doesn't leave the loop early in the unoptimized code.
+      if (use->opcode() == IrOpcode::kDeoptimize ||
+          use->opcode() == IrOpcode::kTerminate) {
+        continue;
+      }
+      return false;
+    }
+  }
+  return true;
+}
+
+Node* BoundsCheckElimination::GetOrCreateLoopGuard(Node* loop, Node* branch,
+                                                   Node* index, Node* length,
+                                                   Node* check_bounds) {
+  Node* condition = NodeProperties::GetValueInput(branch, 0);
+  Node* bound = NodeProperties::GetValueInput(condition, 1);
+  for (const LoopGuard& guard : loop_guards_) {
+    if (guard.loop == loop && guard.index == index && guard.bound == bound &&
+        guard.length == length) {
+      return guard.check;
+    }
+  }
+
+  // The guard must only fail if the loop would access an element out of
+  // bounds. That is the case if the loop runs through all values from {start}
+  // to (bound - 1), accessing each of them, and ({start} < bound) and
+  // (length < bound) hold, i.e. if (max(start, length) < bound).
+  Node* start = MatchIncrementingInductionVariable(index, loop);
+  if (start == nullptr ||
+      !NodeProperties::GetType(start).Is(Type::Number()) ||
+      !NodeProperties::GetType(bound).Is(Type::Number()) ||
+      !NodeProperties::GetType(length).Is(Type::Number())) {
+    return nullptr;
+  }
+  LoopTree::Loop* loop_info = loop_tree_->ContainingLoop(loop);
+  if (loop_info == nullptr || loop_tree_->Contains(loop_info, bound) ||
+      loop_tree_->Contains(loop_info, length) ||
+      !IsOnlyLoopExit(loop_info, branch)) {
+    return nullptr;
+  }
+  Node* effect_phi = nullptr;
+  for (Node* use : loop->uses()) {
+    if (use->opcode() == IrOpcode::kEffectPhi) {
+      effect_phi = use;
+      break;
+    }
+  }
+  if (effect_phi == nullptr) return nullptr;
+  Node* effect = NodeProperties::GetEffectInput(effect_phi, 0);
+  if (!LoopInvariantCodeMotion::IsPrecededByCheckpoint(effect)) return nullptr;
+
+  Graph* graph = jsgraph()->graph();
+  SimplifiedOperatorBuilder* simplified = jsgraph()->simplified();
+  Node* limit = graph->NewNode(simplified->NumberMax(), start, length);
+  Node* in_bounds =
+      graph->NewNode(simplified->NumberLessThanOrEqual(), bound, limit);
+  FeedbackSource const& feedback =
+      CheckBoundsParametersOf(check_bounds->op()).check_parameters().feedback();
+  Node* check = graph->NewNode(
+      simplified->CheckIf(DeoptimizeReason::kOutOfBounds, feedback), in_bounds,
+      effect, NodeProperties::GetControlInput(loop, 0));
+  NodeProperties::ReplaceEffectInput(effect_phi, check, 0);
+  loop_guards_.push_back({loop, index, bound, length, check});
+  return check;
+}
+
+void BoundsCheckElimination::Eliminate(Node* node) {
+  // Keep the narrowed type of the index for the uses of {node}.
+  Type type = NodeProperties::GetType(node);
+  node->RemoveInput(1);
+  NodeProperties::ChangeOp(node, jsgraph()->common()->TypeGuard(type));
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,82 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+#define V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+
+#include "src/compiler/loop-analysis.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class JSGraph;
+class Node;
+
+// Removes CheckBounds nodes whose index is known to be within bounds, mostly
+// for element accesses in loops like
+//
+//   for (let i = 0; i < a.length; i++) a[i]
+//   for (let i = a.length - 1; i >= 0; i--) a[i]
+//
+// The index must be a non-negative integer, either by its type or by a
+// dominating branch in the same loop iteration, and must be below an upper
+// bound that is either given by a dominating branch (i < bound) or by a
+// decreasing induction variable that starts at (bound - c). If the bound is
+// the length that is checked against, the check is removed right away.
+// Otherwise, e.g. for loops over several arrays or up to some other limit,
+// the check can be replaced by a single check in front of the loop, which
+// deoptimizes to the loop entry. This is only done if that check fails
+// exactly when the loop would access an element out of bounds:
+// - The bound and the length are defined outside of the loop.
+// - The (index < bound) branch is the only branch guarding the check, and
+//   its false projection is the only exit of the loop.
+// - The index is an induction variable that starts outside of the loop and is
+//   incremented by one in each iteration.
+// The check in front of the loop is then (bound <= max(start, length)).
+//
+// Removed checks become TypeGuards, so that their uses keep their types.
+class V8_EXPORT_PRIVATE BoundsCheckElimination {
+ public:
+  BoundsCheckElimination(JSGraph* jsgraph, LoopTree* loop_tree, Zone* tmp_zone)
+      : jsgraph_(jsgraph),
+        loop_tree_(loop_tree),
+        tmp_zone_(tmp_zone),
+        loop_guards_(tmp_zone) {}
+
+  void Run();
+
+ private:
+  // A (bound <= max(start, length)) check in front of a loop whose exit test
+  // is (index < bound).
+  struct LoopGuard {
+    Node* loop;
+    Node* index;
+    Node* bound;
+    Node* length;
+    Node* check;
+  };
+
+  void VisitCheckBounds(Node* node);
+  // Returns whether the false projection of {branch} is the only exit of
+  // {loop}, not counting deoptimizations.
+  bool IsOnlyLoopExit(LoopTree::Loop* loop, Node* branch);
+  Node* GetOrCreateLoopGuard(Node* loop, Node* branch, Node* index,
+                             Node* length, Node* check_bounds);
+  void Eliminate(Node* node);
+
+  JSGraph* jsgraph() const { return jsgraph_; }
+
+  JSGraph* const jsgraph_;
+  LoopTree* const loop_tree_;
+  Zone* const tmp_zone_;
+  ZoneVector<LoopGuard> loop_guards_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
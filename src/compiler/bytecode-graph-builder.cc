@@ -317,6 +317,10 @@ class BytecodeGraphBuilder {
   void BuildIterationBodyStackCheck();
   void BuildOSREntryStackCheck();
 
+  // Counts the invocations of code compiled at the reduced optimization level,
+  // and deopts once the function should be recompiled at the full level.
+  void BuildReducedOptimizationTierUpCheck();
+
   // Control flow plumbing.
   void BuildJump();
   void BuildJumpIf(Node* condition);
@@ -465,6 +469,7 @@ class BytecodeGraphBuilder {
   int currently_peeled_loop_offset_;
 
   const bool skip_first_stack_and_tierup_check_;
+  const bool reduced_optimization_;
 
   // Merge environments are snapshots of the environment at points where the
   // control flow merges. This models a forward data flow propagation of all
@@ -1058,6 +1063,8 @@ BytecodeGraphBuilder::BytecodeGraphBuilder(
       currently_peeled_loop_offset_(-1),
       skip_first_stack_and_tierup_check_(
           flags & BytecodeGraphBuilderFlag::kSkipFirstStackAndTierupCheck),
+      reduced_optimization_(flags &
+                            BytecodeGraphBuilderFlag::kReducedOptimization),
       merge_environments_(local_zone),
       generator_merge_environments_(local_zone),
       cached_parameters_(local_zone),
@@ -1323,6 +1330,31 @@ void BytecodeGraphBuilder::BuildFunctionEntryStackCheck() {
   }
 }
 
+void BytecodeGraphBuilder::BuildReducedOptimizationTierUpCheck() {
+  DCHECK(!skip_tierup_check());
+  // Count the invocation, and deopt to the function entry once the function
+  // reaches the invocation count from which it is compiled at the full level
+  // (see TieringManager::UseReducedTurbofanPipeline). The tiering manager then
+  // requests the recompilation.
+  FieldAccess access = AccessBuilder::ForFeedbackVectorInvocationCount();
+  Node* vector = feedback_vector_node();
+  Node* count = NewNode(simplified()->NumberAdd(),
+                        NewNode(simplified()->LoadField(access), vector),
+                        jsgraph()->OneConstant());
+  NewNode(simplified()->StoreField(access), vector, count);
+  Node* is_hot = NewNode(
+      simplified()->NumberLessThanOrEqual(),
+      jsgraph()->Constant(FLAG_turbo_full_optimization_invocation_count),
+      count);
+  Node* frame_state =
+      environment()->Checkpoint(BytecodeOffset(kFunctionEntryBytecodeOffset),
+                                OutputFrameStateCombine::Ignore(),
+                                bytecode_analysis().GetInLivenessFor(0));
+  NewNode(common()->DeoptimizeIf(DeoptimizeReason::kTierUpToFullOptimization,
+                                 FeedbackSource()),
+          is_hot, frame_state);
+}
+
 void BytecodeGraphBuilder::BuildIterationBodyStackCheck() {
   Node* node =
       NewNode(javascript()->StackCheck(StackCheckKind::kJSIterationBody));
@@ -1454,6 +1486,9 @@ void BytecodeGraphBuilder::VisitBytecodes() {
     AdvanceToOsrEntryAndPeelLoops();
   } else {
     BuildFunctionEntryStackCheck();
+    if (reduced_optimization_ && !skip_tierup_check()) {
+      BuildReducedOptimizationTierUpCheck();
+    }
   }
 
   for (; !bytecode_iterator().done(); bytecode_iterator().Advance()) {
@@ -36,6 +36,9 @@ enum class BytecodeGraphBuilderFlag : uint8_t {
   // bytecode analysis.
   kAnalyzeEnvironmentLiveness = 1 << 1,
   kBailoutOnUninitialized = 1 << 2,
+  // The function is compiled at the reduced optimization level, and its code
+  // has to request a recompilation once the function gets hot.
+  kReducedOptimization = 1 << 3,
 };
 using BytecodeGraphBuilderFlags = base::Flags<BytecodeGraphBuilderFlag>;
 
@@ -196,8 +196,12 @@ class EffectControlLinearizer {
   Node* AdaptFastCallTypedArrayArgument(Node* node,
                                         ElementsKind expected_elements_kind,
                                         GraphAssemblerLabel<0>* bailout);
+  Node* AdaptFastCallStringArgument(Node* node, String::Encoding encoding,
+                                    GraphAssemblerLabel<0>* bailout);
   Node* AdaptFastCallArgument(Node* node, CTypeInfo arg_type,
                               GraphAssemblerLabel<0>* if_error);
+  Node* AdaptFastCallStringResult(Node* result,
+                                  GraphAssemblerLabel<0>* if_error);
 
   struct AdaptOverloadedFastCallResult {
     Node* target_address;
@@ -4944,6 +4948,53 @@ Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
   return stack_slot;
 }
 
+Node* EffectControlLinearizer::AdaptFastCallStringArgument(
+    Node* node, String::Encoding encoding, GraphAssemblerLabel<0>* bailout) {
+  // Only the characters of sequential strings can be passed without copying.
+  // Other strings, e.g. cons or sliced strings, and non-strings take the slow
+  // path.
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  const int kMask =
+      kIsNotStringMask | kStringRepresentationMask | kStringEncodingMask;
+  const int kExpected =
+      kStringTag | kSeqStringTag |
+      (encoding == String::ONE_BYTE_ENCODING ? kOneByteStringTag
+                                             : kTwoByteStringTag);
+  Node* value_is_expected_string = __ Word32Equal(
+      __ Word32And(value_instance_type, __ Int32Constant(kMask)),
+      __ Int32Constant(kExpected));
+  __ GotoIfNot(value_is_expected_string, bailout);
+
+  // The characters stay in place during the call, since the fast callback
+  // can't trigger a GC.
+  STATIC_ASSERT(SeqOneByteString::kHeaderSize ==
+                SeqTwoByteString::kHeaderSize);
+  Node* data_ptr = __ UnsafePointerAdd(
+      __ BitcastTaggedToWord(node),
+      __ IntPtrConstant(SeqOneByteString::kHeaderSize - kHeapObjectTag));
+  Node* length = __ LoadField(AccessBuilder::ForStringLength(), node);
+
+  static_assert(sizeof(FastOneByteString) == sizeof(FastTwoByteString) &&
+                    offsetof(FastOneByteString, data) ==
+                        offsetof(FastTwoByteString, data) &&
+                    offsetof(FastOneByteString, length) ==
+                        offsetof(FastTwoByteString, length),
+                "FastOneByteString and FastTwoByteString must have the same "
+                "layout.");
+  Node* stack_slot = __ StackSlot(sizeof(FastOneByteString),
+                                  alignof(FastOneByteString));
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(FastOneByteString, data)),
+           data_ptr);
+  __ Store(StoreRepresentation(MachineRepresentation::kWord32, kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(FastOneByteString, length)),
+           length);
+  return stack_slot;
+}
+
 Node* EffectControlLinearizer::AdaptFastCallArgument(
     Node* node, CTypeInfo arg_type, GraphAssemblerLabel<0>* if_error) {
   int kAlign = alignof(uintptr_t);
@@ -4962,6 +5013,19 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
         case CTypeInfo::Type::kFloat32: {
           return __ TruncateFloat64ToFloat32(node);
         }
+        case CTypeInfo::Type::kSeqOneByteString:
+        case CTypeInfo::Type::kSeqTwoByteString: {
+          // Check that the value is a HeapObject.
+          Node* value_is_smi = ObjectIsSmi(node);
+          __ GotoIf(value_is_smi, if_error);
+
+          return AdaptFastCallStringArgument(
+              node,
+              arg_type.GetType() == CTypeInfo::Type::kSeqOneByteString
+                  ? String::ONE_BYTE_ENCODING
+                  : String::TWO_BYTE_ENCODING,
+              if_error);
+        }
         default: {
           return node;
         }
@@ -5004,6 +5068,63 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
   }
 }
 
+Node* EffectControlLinearizer::AdaptFastCallStringResult(
+    Node* result, GraphAssemblerLabel<0>* if_error) {
+  // A null result, or one longer than kMaxReturnLength, takes the slow path.
+  __ GotoIf(__ WordEqual(result, __ IntPtrConstant(0)), if_error);
+  Node* data = __ Load(MachineType::Pointer(), result,
+                       static_cast<int>(offsetof(FastOneByteString, data)));
+  Node* length = __ Load(MachineType::Uint32(), result,
+                         static_cast<int>(offsetof(FastOneByteString, length)));
+  __ GotoIf(__ Uint32LessThan(
+                __ Uint32Constant(FastOneByteString::kMaxReturnLength), length),
+            if_error);
+
+  // Allocate the result, see SeqOneByteString::SizeFor.
+  Node* length_ptr = ChangeUint32ToUintPtr(length);
+  Node* size = __ WordAnd(
+      __ IntAdd(length_ptr, __ IntPtrConstant(SeqOneByteString::kHeaderSize +
+                                              kObjectAlignmentMask)),
+      __ IntPtrConstant(~kObjectAlignmentMask));
+  Node* string = __ Allocate(AllocationType::kYoung, size);
+
+  // Clear the padding before the header is written, since for short strings
+  // the last tagged word overlaps the header.
+  Node* padding_offset =
+      __ IntSub(size, __ IntPtrConstant(kTaggedSize + kHeapObjectTag));
+  __ Store(StoreRepresentation(kTaggedSize == kInt32Size
+                                   ? MachineRepresentation::kWord32
+                                   : MachineRepresentation::kWord64,
+                               kNoWriteBarrier),
+           string, padding_offset,
+           kTaggedSize == kInt32Size ? __ Int32Constant(0)
+                                     : __ IntPtrConstant(0));
+  __ StoreField(AccessBuilder::ForMap(), string,
+                __ HeapConstant(factory()->one_byte_string_map()));
+  __ StoreField(AccessBuilder::ForNameRawHashField(), string,
+                __ Int32Constant(Name::kEmptyHashField));
+  __ StoreField(AccessBuilder::ForStringLength(), string, length);
+
+  // Copy the characters. The callback guarantees that they are not on the V8
+  // heap, so the allocation above cannot have moved them.
+  MachineSignature::Builder builder(graph()->zone(), 1, 3);
+  builder.AddReturn(MachineType::Pointer());
+  builder.AddParam(MachineType::Pointer());
+  builder.AddParam(MachineType::Pointer());
+  builder.AddParam(MachineType::UintPtr());
+  Node* memcpy_function =
+      __ ExternalConstant(ExternalReference::libc_memcpy_function());
+  auto call_descriptor =
+      Linkage::GetSimplifiedCDescriptor(graph()->zone(), builder.Build());
+  Node* destination =
+      __ IntAdd(__ BitcastTaggedToWord(string),
+                __ IntPtrConstant(SeqOneByteString::kHeaderSize -
+                                  kHeapObjectTag));
+  __ Call(common()->Call(call_descriptor), memcpy_function, destination, data,
+          length_ptr);
+  return string;
+}
+
 EffectControlLinearizer::AdaptOverloadedFastCallResult
 EffectControlLinearizer::AdaptOverloadedFastCallArgument(
     Node* node, const FastApiCallFunctionVector& c_functions,
@@ -5014,19 +5135,36 @@ EffectControlLinearizer::AdaptOverloadedFastCallArgument(
   auto merge = __ MakeLabel(MachineRepresentation::kTagged,
                             MachineRepresentation::kTagged);
 
+  ExternalReference::Type ref_type = ExternalReference::FAST_C_CALL;
+
+  // An overload taking a v8::Value accepts the values that none of the other
+  // overloads accept, so it is checked last.
+  int generic_func_index = -1;
+  auto if_generic = __ MakeLabel();
+  GraphAssemblerLabel<0>* if_no_match = if_error;
+  for (size_t func_index = 0; func_index < c_functions.size(); func_index++) {
+    CTypeInfo arg_type = c_functions[func_index].signature->ArgumentInfo(
+        overloads_resolution_result.distinguishable_arg_index + kReceiver);
+    if (arg_type.GetSequenceType() == CTypeInfo::SequenceType::kScalar) {
+      DCHECK_EQ(arg_type.GetType(), CTypeInfo::Type::kV8Value);
+      generic_func_index = static_cast<int>(func_index);
+      if_no_match = &if_generic;
+    }
+  }
+
+  // Check that the value is a HeapObject.
+  Node* value_is_smi = ObjectIsSmi(node);
+  __ GotoIf(value_is_smi, if_no_match);
+
   for (size_t func_index = 0; func_index < c_functions.size(); func_index++) {
+    if (static_cast<int>(func_index) == generic_func_index) continue;
+
     const CFunctionInfo* c_signature = c_functions[func_index].signature;
     CTypeInfo arg_type = c_signature->ArgumentInfo(
         overloads_resolution_result.distinguishable_arg_index + kReceiver);
 
     auto next = __ MakeLabel();
 
-    // Check that the value is a HeapObject.
-    Node* value_is_smi = ObjectIsSmi(node);
-    __ GotoIf(value_is_smi, if_error);
-
-    ExternalReference::Type ref_type = ExternalReference::FAST_C_CALL;
-
     switch (arg_type.GetSequenceType()) {
       case CTypeInfo::SequenceType::kIsSequence: {
         CHECK_EQ(arg_type.GetType(), CTypeInfo::Type::kVoid);
@@ -5057,9 +5195,7 @@ EffectControlLinearizer::AdaptOverloadedFastCallArgument(
         // Check that the value is a TypedArray with a type that matches the
         // type declared in the c-function.
         Node* stack_slot = AdaptFastCallTypedArrayArgument(
-            node,
-            fast_api_call::GetTypedArrayElementsKind(
-                overloads_resolution_result.element_type),
+            node, fast_api_call::GetTypedArrayElementsKind(arg_type.GetType()),
             &next);
         Node* target_address = __ ExternalConstant(ExternalReference::Create(
             c_functions[func_index].address, ref_type));
@@ -5074,7 +5210,18 @@ EffectControlLinearizer::AdaptOverloadedFastCallArgument(
 
     __ Bind(&next);
   }
-  __ Goto(if_error);
+  __ Goto(if_no_match);
+
+  if (generic_func_index >= 0) {
+    __ Bind(&if_generic);
+    CTypeInfo arg_type =
+        c_functions[generic_func_index].signature->ArgumentInfo(
+            overloads_resolution_result.distinguishable_arg_index + kReceiver);
+    Node* stack_slot = AdaptFastCallArgument(node, arg_type, if_error);
+    Node* target_address = __ ExternalConstant(ExternalReference::Create(
+        c_functions[generic_func_index].address, ref_type));
+    __ Goto(&merge, target_address, stack_slot);
+  }
 
   __ Bind(&merge);
   return {merge.PhiAt(0), merge.PhiAt(1)};
@@ -5240,7 +5387,7 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
   if (c_functions.size() == 1) {
     generate_fast_call = true;
   } else {
-    DCHECK_EQ(c_functions.size(), 2);
+    DCHECK_GE(c_functions.size(), 2);
     overloads_resolution_result = fast_api_call::ResolveOverloads(
         graph()->zone(), c_functions, c_arg_count);
     if (overloads_resolution_result.is_valid()) {
@@ -5333,7 +5480,12 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
       fast_call_result = ChangeFloat64ToTagged(
           c_call_result, CheckForMinusZeroMode::kCheckForMinusZero);
       break;
+    case CTypeInfo::Type::kSeqOneByteString:
+      // Converted on the success path below, since the result must not be
+      // dereferenced if the callback requested a fallback.
+      break;
     case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kSeqTwoByteString:
     case CTypeInfo::Type::kApiObject:
       UNREACHABLE();
     case CTypeInfo::Type::kAny:
@@ -5358,6 +5510,10 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
   }
 
   __ Bind(&if_success);
+  if (c_signature->ReturnInfo().GetType() ==
+      CTypeInfo::Type::kSeqOneByteString) {
+    fast_call_result = AdaptFastCallStringResult(c_call_result, &if_error);
+  }
   __ Goto(&merge, fast_call_result);
 
   // Generate direct slow call.
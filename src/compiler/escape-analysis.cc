@@ -517,6 +517,10 @@ int OffsetOfFieldAccess(const Operator* op) {
   return access.offset;
 }
 
+// Loads of elements at unknown indices from virtual objects with at most this
+// many elements are turned into a chain of Select operations.
+constexpr int kMaxElementsForSelect = 4;
+
 Maybe<int> OffsetOfElementAt(ElementAccess const& access, int index) {
   MachineRepresentation representation = access.machine_type.representation();
   // Double elements accesses are not yet supported. See chromium:1237821.
@@ -650,50 +654,54 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         int const length =
             (vobject->size() - access.header_size) >>
             ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
-        if (length == 1 &&
-            vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
-            current->Get(var).To(&value) &&
-            (value == nullptr ||
-             NodeProperties::GetType(value).Is(access.type))) {
-          // The {object} has no elements, and we know that the LoadElement
-          // {index} must be within bounds, thus it must always yield this
-          // one element of {object}.
-          current->SetReplacement(value);
-          break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
-            Node* check =
-                jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
-            NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
-                jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
-            NodeProperties::SetType(select, access.type);
-            current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
+        if (length >= 1 && length <= kMaxElementsForSelect) {
+          // The LoadElement {index} must be within bounds, so it must always
+          // yield one of the few elements of {object}.
+          Node* values[kMaxElementsForSelect];
+          bool all_known = true;
+          bool all_initialized = true;
+          for (int i = 0; i < length; ++i) {
+            if (!vobject->FieldAt(OffsetOfElementAt(access, i)).To(&var) ||
+                !current->Get(var).To(&values[i]) ||
+                (values[i] != nullptr &&
+                 !NodeProperties::GetType(values[i]).Is(access.type))) {
+              all_known = false;
+              break;
+            }
+            // If a variable has no value, we have not reached the fixed-point
+            // yet.
+            if (values[i] == nullptr) all_initialized = false;
+          }
+          if (all_known && !all_initialized) break;
+          if (all_known && length == 1) {
+            current->SetReplacement(values[0]);
             break;
-          } else {
-            // If the variables have no values, we have
-            // not reached the fixed-point yet.
+          }
+          if (all_known) {
+            // Turn the LoadElement into a chain of Select operations that
+            // picks the element by comparing the {index} with each position
+            // (still allowing the {object} to be scalar replaced). We must
+            // however mark the elements of the {object} itself as escaping.
+            Node* select = values[length - 1];
+            for (int i = length - 2; i >= 0; --i) {
+              Node* position = jsgraph->Constant(i);
+              if (!NodeProperties::IsTyped(position)) {
+                NodeProperties::SetType(
+                    position, Type::Constant(i, jsgraph->graph()->zone()));
+              }
+              Node* check = jsgraph->graph()->NewNode(
+                  jsgraph->simplified()->NumberEqual(), index, position);
+              NodeProperties::SetType(check, Type::Boolean());
+              select = jsgraph->graph()->NewNode(
+                  jsgraph->common()->Select(
+                      access.machine_type.representation()),
+                  check, values[i], select);
+              NodeProperties::SetType(select, access.type);
+            }
+            current->SetReplacement(select);
+            for (int i = 0; i < length; ++i) {
+              current->SetEscaped(values[i]);
+            }
             break;
           }
         }
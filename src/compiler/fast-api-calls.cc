@@ -4,6 +4,7 @@
 
 #include "src/compiler/fast-api-calls.h"
 
+#include "src/base/small-vector.h"
 #include "src/compiler/globals.h"
 
 namespace v8 {
@@ -28,56 +29,213 @@ ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type) {
     case CTypeInfo::Type::kVoid:
     case CTypeInfo::Type::kBool:
     case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kSeqOneByteString:
+    case CTypeInfo::Type::kSeqTwoByteString:
     case CTypeInfo::Type::kApiObject:
     case CTypeInfo::Type::kAny:
       UNREACHABLE();
   }
 }
 
+namespace {
+
+bool IsSameArgumentType(const CTypeInfo& a, const CTypeInfo& b) {
+  return a.GetSequenceType() == b.GetSequenceType() &&
+         a.GetType() == b.GetType();
+}
+
+}  // namespace
+
 OverloadsResolutionResult ResolveOverloads(
     Zone* zone, const FastApiCallFunctionVector& candidates,
     unsigned int arg_count) {
   DCHECK_GT(arg_count, 0);
+  DCHECK_GE(candidates.size(), 2);
 
   static constexpr int kReceiver = 1;
 
-  // Only the case of the overload resolution of two functions, one with a
-  // JSArray param and the other with a typed array param is currently
-  // supported.
-  DCHECK_EQ(candidates.size(), 2);
+  // The candidates are called through the same call descriptor.
+  const CFunctionInfo* first_signature = candidates[0].signature;
+  for (size_t i = 1; i < candidates.size(); i++) {
+    const CFunctionInfo* c_signature = candidates[i].signature;
+    if (c_signature->HasOptions() != first_signature->HasOptions() ||
+        !IsSameArgumentType(c_signature->ReturnInfo(),
+                            first_signature->ReturnInfo())) {
+      return OverloadsResolutionResult::Invalid();
+    }
+  }
 
+  // Find the only argument position at which the candidates differ.
+  int distinguishable_arg_index = -1;
   for (unsigned int arg_index = 0; arg_index < arg_count - kReceiver;
        arg_index++) {
-    int index_of_func_with_js_array_arg = -1;
-    int index_of_func_with_typed_array_arg = -1;
-    CTypeInfo::Type element_type = CTypeInfo::Type::kVoid;
-
-    for (size_t i = 0; i < candidates.size(); i++) {
-      const CTypeInfo& type_info =
-          candidates[i].signature->ArgumentInfo(arg_index + kReceiver);
-      CTypeInfo::SequenceType sequence_type = type_info.GetSequenceType();
-
-      if (sequence_type == CTypeInfo::SequenceType::kIsSequence) {
-        DCHECK_LT(index_of_func_with_js_array_arg, 0);
-        index_of_func_with_js_array_arg = static_cast<int>(i);
-      } else if (sequence_type == CTypeInfo::SequenceType::kIsTypedArray) {
-        DCHECK_LT(index_of_func_with_typed_array_arg, 0);
-        index_of_func_with_typed_array_arg = static_cast<int>(i);
-        element_type = type_info.GetType();
-      } else {
-        DCHECK_LT(index_of_func_with_js_array_arg, 0);
-        DCHECK_LT(index_of_func_with_typed_array_arg, 0);
+    const CTypeInfo& first_type_info =
+        first_signature->ArgumentInfo(arg_index + kReceiver);
+    for (size_t i = 1; i < candidates.size(); i++) {
+      if (!IsSameArgumentType(
+              first_type_info,
+              candidates[i].signature->ArgumentInfo(arg_index + kReceiver))) {
+        if (distinguishable_arg_index >= 0) {
+          return OverloadsResolutionResult::Invalid();
+        }
+        distinguishable_arg_index = static_cast<int>(arg_index);
+        break;
       }
     }
+  }
+  if (distinguishable_arg_index < 0) {
+    return OverloadsResolutionResult::Invalid();
+  }
+
+  // At this position, each candidate must be selectable by the instance type
+  // of the argument: at most one takes a JSArray, at most one a typed array of
+  // each element type, and at most one takes any other v8::Value.
+  bool has_js_array = false;
+  bool has_v8_value = false;
+  base::SmallVector<CTypeInfo::Type, 4> typed_array_element_types;
+  for (size_t i = 0; i < candidates.size(); i++) {
+    const CTypeInfo& type_info = candidates[i].signature->ArgumentInfo(
+        distinguishable_arg_index + kReceiver);
+    switch (type_info.GetSequenceType()) {
+      case CTypeInfo::SequenceType::kIsSequence:
+        if (has_js_array) return OverloadsResolutionResult::Invalid();
+        has_js_array = true;
+        break;
+      case CTypeInfo::SequenceType::kIsTypedArray:
+        for (CTypeInfo::Type element_type : typed_array_element_types) {
+          if (element_type == type_info.GetType()) {
+            return OverloadsResolutionResult::Invalid();
+          }
+        }
+        typed_array_element_types.emplace_back(type_info.GetType());
+        break;
+      case CTypeInfo::SequenceType::kScalar:
+        if (type_info.GetType() != CTypeInfo::Type::kV8Value || has_v8_value) {
+          return OverloadsResolutionResult::Invalid();
+        }
+        has_v8_value = true;
+        break;
+      case CTypeInfo::SequenceType::kIsArrayBuffer:
+        return OverloadsResolutionResult::Invalid();
+    }
+  }
+
+  return OverloadsResolutionResult(distinguishable_arg_index);
+}
+
+namespace {
+
+// How well a value of a given type fits a C argument type. Better matches
+// compare greater.
+enum class ArgumentMatch {
+  // The value can never be passed, the call would always deoptimize.
+  kNone,
+  // The value can only be passed after a check that may fail.
+  kChecked,
+  // The value can always be passed, but another C type would fit it more
+  // closely, e.g. a float64 for a Signed32 value.
+  kConverted,
+  // The C type fits the value exactly.
+  kExact,
+};
+
+ArgumentMatch MatchArgument(const CTypeInfo& type_info, Type type) {
+  switch (type_info.GetSequenceType()) {
+    case CTypeInfo::SequenceType::kScalar:
+      break;
+    case CTypeInfo::SequenceType::kIsSequence:
+      if (type.Is(Type::Array())) return ArgumentMatch::kExact;
+      return type.Maybe(Type::Array()) ? ArgumentMatch::kChecked
+                                       : ArgumentMatch::kNone;
+    case CTypeInfo::SequenceType::kIsTypedArray:
+    case CTypeInfo::SequenceType::kIsArrayBuffer:
+      return type.Maybe(Type::OtherObject()) ? ArgumentMatch::kChecked
+                                             : ArgumentMatch::kNone;
+  }
+
+  if (type_info.GetType() == CTypeInfo::Type::kV8Value) {
+    // Anything can be passed as a v8::Value, but any more specific overload
+    // is preferred.
+    return ArgumentMatch::kConverted;
+  }
+
+  Type expected = Type::Number();
+  Type exact = Type::Number();
+  switch (type_info.GetType()) {
+    case CTypeInfo::Type::kVoid:
+    case CTypeInfo::Type::kV8Value:
+      UNREACHABLE();
+    case CTypeInfo::Type::kBool:
+      expected = exact = Type::Boolean();
+      break;
+    case CTypeInfo::Type::kInt32:
+      exact = Type::Signed32();
+      break;
+    case CTypeInfo::Type::kUint32:
+      exact = Type::Unsigned32();
+      break;
+    case CTypeInfo::Type::kInt64:
+    case CTypeInfo::Type::kUint64:
+    case CTypeInfo::Type::kAny:
+    case CTypeInfo::Type::kFloat32:
+      // Always converted, or checked for non-integral values.
+      exact = Type::None();
+      break;
+    case CTypeInfo::Type::kFloat64:
+      // Integral values are exact in a narrower integer overload.
+      if (type.Is(Type::Integral32())) exact = Type::None();
+      break;
+    case CTypeInfo::Type::kSeqOneByteString:
+    case CTypeInfo::Type::kSeqTwoByteString:
+      expected = Type::String();
+      exact = Type::None();
+      break;
+    case CTypeInfo::Type::kApiObject:
+      expected = Type::Receiver();
+      exact = Type::None();
+      break;
+  }
+
+  if (!exact.IsNone() && type.Is(exact)) return ArgumentMatch::kExact;
+  if (type.Is(expected)) {
+    return type_info.GetType() == CTypeInfo::Type::kFloat32 ||
+                   type_info.GetType() == CTypeInfo::Type::kFloat64
+               ? ArgumentMatch::kConverted
+               : ArgumentMatch::kChecked;
+  }
+  return type.Maybe(expected) ? ArgumentMatch::kChecked : ArgumentMatch::kNone;
+}
+
+}  // namespace
 
-    if (index_of_func_with_js_array_arg >= 0 &&
-        index_of_func_with_typed_array_arg >= 0) {
-      return {static_cast<int>(arg_index), element_type};
+FastApiCallFunctionVector SelectOverloadsByType(
+    Zone* zone, const FastApiCallFunctionVector& candidates,
+    base::Vector<const Type> arg_types) {
+  static constexpr int kReceiver = 1;
+
+  // A candidate is as good as its worst matching argument.
+  base::SmallVector<ArgumentMatch, 4> matches(candidates.size());
+  ArgumentMatch best = ArgumentMatch::kNone;
+  for (size_t i = 0; i < candidates.size(); i++) {
+    const CFunctionInfo* c_signature = candidates[i].signature;
+    DCHECK_EQ(c_signature->ArgumentCount(), arg_types.size());
+    ArgumentMatch match = ArgumentMatch::kExact;
+    for (unsigned int arg_index = kReceiver;
+         arg_index < c_signature->ArgumentCount(); arg_index++) {
+      match = std::min(match, MatchArgument(c_signature->ArgumentInfo(arg_index),
+                                            arg_types[arg_index]));
     }
+    matches[i] = match;
+    best = std::max(best, match);
   }
 
-  // No overload found with a JSArray and a typed array as i-th argument.
-  return OverloadsResolutionResult::Invalid();
+  if (best == ArgumentMatch::kNone) return candidates;
+
+  FastApiCallFunctionVector result(zone);
+  for (size_t i = 0; i < candidates.size(); i++) {
+    if (matches[i] == best) result.push_back(candidates[i]);
+  }
+  return result;
 }
 
 bool CanOptimizeFastSignature(const CFunctionInfo* c_signature) {
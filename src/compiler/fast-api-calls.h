@@ -6,7 +6,9 @@
 #define V8_COMPILER_FAST_API_CALLS_H_
 
 #include "include/v8-fast-api-calls.h"
+#include "src/base/vector.h"
 #include "src/compiler/graph-assembler.h"
+#include "src/compiler/types.h"
 
 namespace v8 {
 namespace internal {
@@ -15,33 +17,38 @@ namespace fast_api_call {
 
 struct OverloadsResolutionResult {
   static OverloadsResolutionResult Invalid() {
-    return OverloadsResolutionResult(-1, CTypeInfo::Type::kVoid);
+    return OverloadsResolutionResult(-1);
   }
 
-  OverloadsResolutionResult(int distinguishable_arg_index_,
-                            CTypeInfo::Type element_type_)
-      : distinguishable_arg_index(distinguishable_arg_index_),
-        element_type(element_type_) {
-    DCHECK(distinguishable_arg_index_ < 0 ||
-           element_type_ != CTypeInfo::Type::kVoid);
-  }
+  explicit OverloadsResolutionResult(int distinguishable_arg_index_)
+      : distinguishable_arg_index(distinguishable_arg_index_) {}
 
   bool is_valid() const { return distinguishable_arg_index >= 0; }
 
-  // The index of the distinguishable overload argument. Only the case where the
-  // types of this argument is a JSArray vs a TypedArray is supported.
+  // The index of the distinguishable overload argument. The candidates can
+  // take a JSArray, typed arrays of different element types or, as a fallback
+  // for any other value, a v8::Value at this position.
   int distinguishable_arg_index;
-
-  // The element type in the typed array argument.
-  CTypeInfo::Type element_type;
 };
 
 ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type);
 
+// Returns the argument position at which the {candidates} can be told apart
+// at runtime by the instance type of the argument, if any. All other
+// arguments must have the same type in all candidates.
 OverloadsResolutionResult ResolveOverloads(
     Zone* zone, const FastApiCallFunctionVector& candidates,
     unsigned int arg_count);
 
+// Returns the {candidates} that fit the statically known {arg_types} of the
+// C arguments best, e.g. an int32 overload for a Signed32 argument and a
+// float64 overload for other numbers, or the overload taking a JSArray for an
+// Array argument. Candidates that can't accept one of the arguments at all are
+// dropped, unless that would drop all of them.
+FastApiCallFunctionVector SelectOverloadsByType(
+    Zone* zone, const FastApiCallFunctionVector& candidates,
+    base::Vector<const Type> arg_types);
+
 bool CanOptimizeFastSignature(const CFunctionInfo* c_signature);
 
 }  // namespace fast_api_call
@@ -5,6 +5,7 @@
 #include "src/compiler/js-call-reducer.h"
 
 #include <functional>
+#include <limits>
 
 #include "src/api/api-inl.h"
 #include "src/base/small-vector.h"
@@ -3608,6 +3609,26 @@ Reduction JSCallReducer::ReduceCallWasmFunction(
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+namespace {
+
+// Returns whether the C arguments of {c_signature} after the first {argc} JS
+// arguments can all be passed as undefined.
+bool HasOptionalTrailingArguments(const CFunctionInfo* c_signature,
+                                  size_t argc) {
+  static constexpr int kReceiver = 1;
+  for (size_t i = argc + kReceiver; i < c_signature->ArgumentCount(); i++) {
+    const CTypeInfo& type_info =
+        c_signature->ArgumentInfo(static_cast<unsigned int>(i));
+    if (type_info.GetSequenceType() != CTypeInfo::SequenceType::kScalar ||
+        type_info.GetType() != CTypeInfo::Type::kV8Value) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 // Given a FunctionTemplateInfo, checks whether the fast API call can be
 // optimized, applying the initial step of the overload resolution algorithm:
 // Given an overload set function_template_info.c_signatures, and a list of
@@ -3618,6 +3639,9 @@ Reduction JSCallReducer::ReduceCallWasmFunction(
 // 3. Initialize arg_count = min(max_arg, argc).
 // 4. Remove from the set all entries whose type list is not of length
 //    arg_count.
+// 5. If no entries remain, take the entries with the shortest type list that
+//    is longer than argc and whose trailing (optional) arguments are all
+//    v8::Values. These are passed as undefined.
 // Returns an array with the indexes of the remaining entries in S, which
 // represents the set of "optimizable" function overloads.
 
@@ -3660,6 +3684,22 @@ FastApiCallFunctionVector CanOptimizeFastCall(
       result.push_back({functions[i], c_signature});
     }
   }
+  if (!result.empty()) return result;
+
+  // Only considers entries whose missing arguments are optional.
+  size_t min_optional_len = std::numeric_limits<size_t>::max();
+  for (size_t i = 0; i < overloads_count; i++) {
+    const CFunctionInfo* c_signature = signatures[i];
+    const size_t len = c_signature->ArgumentCount() - kReceiver;
+    if (len <= argc || len > min_optional_len) continue;
+    if (!HasOptionalTrailingArguments(c_signature, argc)) continue;
+    if (!fast_api_call::CanOptimizeFastSignature(c_signature)) continue;
+    if (len < min_optional_len) {
+      min_optional_len = len;
+      result.clear();
+    }
+    result.push_back({functions[i], c_signature});
+  }
 
   return result;
 }
@@ -3836,7 +3876,6 @@ Reduction JSCallReducer::ReduceCallApiFunction(
 
   FastApiCallFunctionVector c_candidate_functions =
       CanOptimizeFastCall(graph()->zone(), function_template_info, argc);
-  DCHECK_LE(c_candidate_functions.size(), 2);
 
   if (!c_candidate_functions.empty()) {
     FastApiCallReducerAssembler a(this, node, function_template_info,
@@ -666,16 +666,57 @@ ProcessedFeedback const& JSHeapBroker::ReadFeedbackForTemplateObject(
   return *zone()->New<TemplateObjectFeedback>(array, nexus.kind());
 }
 
+void JSHeapBroker::ReadCallTargetProfile(
+    WeakFixedArray profile,
+    ZoneVector<CallFeedback::ProfiledTarget>* profiled_targets) {
+  // The main thread keeps updating the profile while we read it. Every slot
+  // is read exactly once with a relaxed load, so each target and each count
+  // is a valid value on its own, and the shares are computed from this
+  // snapshot only. A target and its count may still be torn across an
+  // update of the entry, which at worst skews the shares: the compiler
+  // guards every inlined target with an identity check and keeps a generic
+  // call for all other targets, so the choice of targets only affects
+  // performance, never correctness.
+  constexpr int kEntries = FeedbackNexus::kCallTargetProfileEntries;
+  MaybeObject targets[kEntries];
+  int counts[kEntries];
+  double total = 0;
+  for (int entry = 0; entry < kEntries; ++entry) {
+    int index = entry * FeedbackNexus::kCallTargetProfileEntrySize;
+    targets[entry] = profile.Get(index);
+    counts[entry] = Smi::ToInt(profile.Get(index + 1).ToSmi());
+    total += counts[entry];
+  }
+  if (total == 0) return;
+  for (int entry = 0; entry < kEntries; ++entry) {
+    HeapObject function;
+    if (!targets[entry]->GetHeapObjectIfWeak(&function)) continue;
+    profiled_targets->push_back(
+        {MakeRefAssumeMemoryFence(this, JSFunction::cast(function)),
+         static_cast<float>(counts[entry] / total)});
+  }
+  std::sort(profiled_targets->begin(), profiled_targets->end(),
+            [](CallFeedback::ProfiledTarget const& a,
+               CallFeedback::ProfiledTarget const& b) {
+              return a.share > b.share;
+            });
+}
+
 ProcessedFeedback const& JSHeapBroker::ReadFeedbackForCall(
     FeedbackSource const& source) {
   FeedbackNexus nexus(source.vector, source.slot, feedback_nexus_config());
   if (nexus.IsUninitialized()) return NewInsufficientFeedback(nexus.kind());
 
   base::Optional<HeapObjectRef> target_ref;
+  ZoneVector<CallFeedback::ProfiledTarget> profiled_targets(zone());
   {
     MaybeObject maybe_target = nexus.GetFeedback();
     HeapObject target_object;
-    if (maybe_target->GetHeapObject(&target_object)) {
+    if (maybe_target->GetHeapObjectIfStrong(&target_object) &&
+        target_object.IsWeakFixedArray()) {
+      ReadCallTargetProfile(WeakFixedArray::cast(target_object),
+                            &profiled_targets);
+    } else if (maybe_target->GetHeapObject(&target_object)) {
       target_ref = MakeRefAssumeMemoryFence(this, target_object);
     }
   }
@@ -684,7 +725,7 @@ ProcessedFeedback const& JSHeapBroker::ReadFeedbackForCall(
   SpeculationMode mode = nexus.GetSpeculationMode();
   CallFeedbackContent content = nexus.GetCallFeedbackContent();
   return *zone()->New<CallFeedback>(target_ref, frequency, mode, content,
-                                    nexus.kind());
+                                    std::move(profiled_targets), nexus.kind());
 }
 
 BinaryOperationHint JSHeapBroker::GetFeedbackForBinaryOperation(
@@ -383,6 +383,9 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
   ProcessedFeedback const& ReadFeedbackForBinaryOperation(
       FeedbackSource const& source) const;
   ProcessedFeedback const& ReadFeedbackForCall(FeedbackSource const& source);
+  void ReadCallTargetProfile(
+      WeakFixedArray profile,
+      ZoneVector<CallFeedback::ProfiledTarget>* profiled_targets);
   ProcessedFeedback const& ReadFeedbackForCompareOperation(
       FeedbackSource const& source) const;
   ProcessedFeedback const& ReadFeedbackForForIn(
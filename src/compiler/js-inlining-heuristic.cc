@@ -148,6 +148,26 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
     return out;
   }
   out.num_functions = 0;
+  if (FLAG_megamorphic_inlining && !m.HasResolvedValue() &&
+      node->opcode() == IrOpcode::kJSCall) {
+    // Speculate on the most frequent targets of a megamorphic call site.
+    CallParameters const& p = CallParametersOf(node->op());
+    if (!p.feedback().IsValid()) return out;
+    ProcessedFeedback const& feedback =
+        broker()->GetFeedbackForCall(p.feedback());
+    if (feedback.IsInsufficient()) return out;
+    for (CallFeedback::ProfiledTarget const& target :
+         feedback.AsCall().profiled_targets()) {
+      if (out.num_functions == kMaxMegamorphicInlining) break;
+      if (target.share < FLAG_min_megamorphic_inlining_share) break;
+      int const n = out.num_functions++;
+      out.functions[n] = target.function;
+      if (CanConsiderForInlining(broker(), target.function)) {
+        out.bytecode[n] = target.function.shared().GetBytecodeArray();
+      }
+    }
+    out.has_fallback = out.num_functions > 0;
+  }
   return out;
 }
 
@@ -652,7 +672,8 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
                                                 int input_count) {
   SourcePositionTable::Scope position(
       source_positions_, source_positions_->GetSourcePosition(node));
-  if (TryReuseDispatch(node, callee, if_successes, calls, inputs,
+  if (!candidate.has_fallback &&
+      TryReuseDispatch(node, callee, if_successes, calls, inputs,
                        input_count)) {
     return;
   }
@@ -667,7 +688,7 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
     // TODO(2206): Make comparison be based on underlying SharedFunctionInfo
     // instead of the target JSFunction reference directly.
     Node* target = jsgraph()->Constant(candidate.functions[i].value());
-    if (i != (num_calls - 1)) {
+    if (i != (num_calls - 1) || candidate.has_fallback) {
       Node* check =
           graph()->NewNode(simplified()->ReferenceEqual(), callee, target);
       Node* branch =
@@ -696,11 +717,22 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
     calls[i] = if_successes[i] =
         graph()->NewNode(node->op(), input_count, inputs);
   }
+
+  // Calls to any other target take the generic path, which must not become a
+  // candidate itself.
+  if (candidate.has_fallback) {
+    inputs[JSCallOrConstructNode::TargetIndex()] = callee;
+    inputs[input_count - 1] = fallthrough_control;
+    calls[num_calls] = if_successes[num_calls] =
+        graph()->NewNode(node->op(), input_count, inputs);
+    seen_.insert(calls[num_calls]->id());
+  }
 }
 
 Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
                                                bool small_function) {
-  int const num_calls = candidate.num_functions;
+  int const num_calls =
+      candidate.num_functions + (candidate.has_fallback ? 1 : 0);
   Node* const node = candidate.node;
 #if V8_ENABLE_WEBASSEMBLY
   DCHECK_NE(node->opcode(), IrOpcode::kJSWasmCall);
@@ -766,8 +798,9 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   ReplaceWithValue(node, value, effect, control);
 
   // Inline the individual, cloned call sites.
-  for (int i = 0; i < num_calls && total_inlined_bytecode_size_ <
-                                       max_inlined_bytecode_size_absolute_;
+  for (int i = 0;
+       i < candidate.num_functions &&
+       total_inlined_bytecode_size_ < max_inlined_bytecode_size_absolute_;
        ++i) {
     if (candidate.can_inline_function[i] &&
         (small_function || total_inlined_bytecode_size_ <
@@ -813,7 +846,9 @@ void JSInliningHeuristic::PrintCandidates() {
   for (const Candidate& candidate : candidates_) {
     os << "- candidate: " << candidate.node->op()->mnemonic() << " node #"
        << candidate.node->id() << " with frequency " << candidate.frequency
-       << ", " << candidate.num_functions << " target(s):" << std::endl;
+       << ", " << candidate.num_functions << " target(s)"
+       << (candidate.has_fallback ? " and a generic fallback" : "") << ":"
+       << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       SharedFunctionInfoRef shared = candidate.functions[i].has_value()
                                          ? candidate.functions[i]->shared()
@@ -48,6 +48,11 @@ class JSInliningHeuristic final : public AdvancedReducer {
   // This limit currently matches what the old compiler did. We may want to
   // re-evaluate and come up with a proper limit for TurboFan.
   static const int kMaxCallPolymorphism = 4;
+  // The maximum number of profiled targets to inline at a megamorphic call
+  // site. The generic call that remains as a fallback takes one more slot of
+  // the dispatch.
+  static const int kMaxMegamorphicInlining = 2;
+  STATIC_ASSERT(kMaxMegamorphicInlining < kMaxCallPolymorphism);
 
   struct Candidate {
     base::Optional<JSFunctionRef> functions[kMaxCallPolymorphism];
@@ -63,6 +68,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
     // we use {num_functions == 1 && functions[0].is_null()} as an indicator.
     base::Optional<SharedFunctionInfoRef> shared_info;
     int num_functions;
+    // Whether the {functions} are the most frequent targets of a megamorphic
+    // call site, so that the dispatch needs to fall back to a generic call.
+    bool has_fallback = false;
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
@@ -0,0 +1,243 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/flags/flags.h"
+#include "src/objects/js-objects.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// Checks whose outcome only depends on their value inputs.
+bool IsValueCheck(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kCheckBounds:
+    case IrOpcode::kCheckHeapObject:
+    case IrOpcode::kCheckIf:
+    case IrOpcode::kCheckNumber:
+    case IrOpcode::kCheckSmi:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Effectful nodes that other nodes on the effect chain can't depend on for
+// their safety, i.e. nodes that don't check anything.
+bool IsNonGuardingEffect(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kAllocate:
+    case IrOpcode::kAllocateRaw:
+    case IrOpcode::kBeginRegion:
+    case IrOpcode::kCheckpoint:
+    case IrOpcode::kFinishRegion:
+    case IrOpcode::kJSStackCheck:
+    case IrOpcode::kLoadElement:
+    case IrOpcode::kLoadField:
+    case IrOpcode::kLoadTypedElement:
+    case IrOpcode::kStoreElement:
+    case IrOpcode::kStoreField:
+    case IrOpcode::kStoreTypedElement:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+// static
+bool LoopInvariantCodeMotion::IsPrecededByCheckpoint(Node* effect) {
+  while (effect->opcode() != IrOpcode::kCheckpoint) {
+    if (effect->op()->EffectInputCount() != 1) return false;
+    if (!effect->op()->HasProperty(Operator::kNoWrite)) return false;
+    effect = NodeProperties::GetEffectInput(effect);
+  }
+  return true;
+}
+
+void LoopInvariantCodeMotion::Run() {
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    ProcessLoop(loop);
+  }
+}
+
+void LoopInvariantCodeMotion::ProcessLoop(LoopTree::Loop* loop) {
+  // Process inner loops first, so that their invariants can be moved further
+  // out of this loop.
+  for (LoopTree::Loop* inner_loop : loop->children()) {
+    ProcessLoop(inner_loop);
+  }
+
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  // No back-jump to the loop header means this is not really a loop.
+  if (loop_node->InputCount() < 2) return;
+  Node* effect_phi = nullptr;
+  for (Node* use : loop_node->uses()) {
+    if (use->opcode() == IrOpcode::kEffectPhi) {
+      effect_phi = use;
+      break;
+    }
+  }
+  if (effect_phi == nullptr) return;
+
+  LoopEffects effects(tmp_zone_);
+  ComputeLoopEffects(loop, &effects);
+  ZoneSet<Node*> hoisted(tmp_zone_);
+  hoisted_ = &hoisted;
+
+  const bool can_hoist_checks =
+      IsPrecededByCheckpoint(NodeProperties::GetEffectInput(effect_phi, 0));
+  // Set once the walk passed a check that stays in the loop. Field loads that
+  // follow it might only be safe because of that check.
+  bool passed_check = false;
+
+  // Walk the effect chain from the loop header for as long as it has a single
+  // successor and doesn't leave the loop, i.e. up to the first branch in the
+  // loop body, including the ones that exit the loop. The nodes on the way are
+  // executed before the loop can be left, so a hoisted check can't fail where
+  // the loop would have exited without executing it. Hoisting a node makes its
+  // successor the next one to look at.
+  Node* current = effect_phi;
+  while (true) {
+    Node* next = nullptr;
+    bool unique = true;
+    for (Edge edge : current->use_edges()) {
+      Node* use = edge.from();
+      if (!NodeProperties::IsEffectEdge(edge)) continue;
+      if (use == effect_phi || use->opcode() == IrOpcode::kTerminate) continue;
+      if (next != nullptr || !loop_tree_->Contains(loop, use)) unique = false;
+      next = use;
+    }
+    if (next == nullptr || !unique) break;
+
+    bool is_check =
+        IsValueCheck(next) || next->opcode() == IrOpcode::kCheckMaps;
+    if ((!is_check || can_hoist_checks) &&
+        (next->opcode() != IrOpcode::kLoadField || !passed_check) &&
+        CanHoist(loop, next, effects)) {
+      if (FLAG_trace_turbo_loop) {
+        PrintF("Hoisting #%d:%s out of loop with header #%d\n", next->id(),
+               next->op()->mnemonic(), loop_node->id());
+      }
+      Hoist(next, loop_node, effect_phi);
+      hoisted.insert(next);
+      continue;
+    }
+    // Nodes with more than one effect input are merges, like the effect phi
+    // of an inner loop.
+    if (next->op()->EffectInputCount() != 1) break;
+    if (!IsNonGuardingEffect(next)) passed_check = true;
+    current = next;
+  }
+  hoisted_ = nullptr;
+}
+
+void LoopInvariantCodeMotion::ComputeLoopEffects(LoopTree::Loop* loop,
+                                                 LoopEffects* effects) {
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    if (node->op()->EffectOutputCount() == 0) continue;
+    if (node->op()->HasProperty(Operator::kNoWrite)) continue;
+    switch (node->opcode()) {
+      case IrOpcode::kBeginRegion:
+      case IrOpcode::kCheckpoint:
+      case IrOpcode::kFinishRegion:
+      case IrOpcode::kStoreElement:
+      case IrOpcode::kStoreTypedElement:
+        break;
+      case IrOpcode::kStoreField: {
+        // Initializing stores to objects allocated in the loop can't affect
+        // the objects that are defined outside of it.
+        Node* object = NodeProperties::GetValueInput(node, 0);
+        if ((object->opcode() == IrOpcode::kAllocate ||
+             object->opcode() == IrOpcode::kAllocateRaw) &&
+            loop_tree_->Contains(loop, object)) {
+          break;
+        }
+        FieldAccess const& access = FieldAccessOf(node->op());
+        if (access.offset == HeapObject::kMapOffset) {
+          effects->writes_maps = true;
+        } else {
+          effects->field_offsets.insert(access.offset);
+        }
+        break;
+      }
+      case IrOpcode::kEnsureWritableFastElements:
+      case IrOpcode::kMaybeGrowFastElements:
+        effects->writes_elements_field = true;
+        break;
+      case IrOpcode::kTransitionAndStoreElement:
+      case IrOpcode::kTransitionElementsKind:
+        effects->writes_maps = true;
+        effects->writes_elements_field = true;
+        break;
+      default:
+        effects->writes_all = true;
+        return;
+    }
+  }
+}
+
+bool LoopInvariantCodeMotion::IsInvariant(LoopTree::Loop* loop,
+                                          Node* node) const {
+  return !loop_tree_->Contains(loop, node) || hoisted_->count(node) != 0;
+}
+
+bool LoopInvariantCodeMotion::CanHoist(LoopTree::Loop* loop, Node* node,
+                                       const LoopEffects& effects) const {
+  if (node->op()->EffectInputCount() != 1) return false;
+  if (node->op()->ControlOutputCount() != 0) return false;
+  for (int i = 0; i < node->op()->ValueInputCount(); ++i) {
+    if (!IsInvariant(loop, NodeProperties::GetValueInput(node, i))) {
+      return false;
+    }
+  }
+  if (node->opcode() == IrOpcode::kCheckBounds) {
+    // Such checks are guarded by an explicit branch and don't deoptimize.
+    CheckBoundsParameters const& params = CheckBoundsParametersOf(node->op());
+    if (params.flags() & CheckBoundsFlag::kAbortOnOutOfBounds) return false;
+  }
+  if (IsValueCheck(node)) return true;
+  switch (node->opcode()) {
+    case IrOpcode::kCheckMaps:
+      return !effects.writes_all && !effects.writes_maps;
+    case IrOpcode::kLoadField: {
+      // A map change might also change the layout of the object.
+      if (effects.writes_all || effects.writes_maps) return false;
+      FieldAccess const& access = FieldAccessOf(node->op());
+      if (access.offset == JSObject::kElementsOffset &&
+          effects.writes_elements_field) {
+        return false;
+      }
+      return effects.field_offsets.count(access.offset) == 0;
+    }
+    default:
+      return false;
+  }
+}
+
+void LoopInvariantCodeMotion::Hoist(Node* node, Node* loop_node,
+                                    Node* effect_phi) {
+  // Remove {node} from the effect chain of the loop...
+  Node* effect = NodeProperties::GetEffectInput(node);
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(effect);
+  }
+  // ...and append it to the effect chain that enters the loop.
+  NodeProperties::ReplaceEffectInput(
+      node, NodeProperties::GetEffectInput(effect_phi, 0));
+  NodeProperties::ReplaceControlInput(
+      node, NodeProperties::GetControlInput(loop_node, 0));
+  NodeProperties::ReplaceEffectInput(effect_phi, node, 0);
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
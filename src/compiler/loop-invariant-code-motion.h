@@ -0,0 +1,80 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+#define V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include "src/compiler/loop-analysis.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class Node;
+
+// Moves loop-invariant checks and loads in front of the loop, where they are
+// executed once instead of in every iteration. This covers map checks and
+// field loads of objects that are defined outside of the loop, including the
+// length of arrays, as long as nothing in the loop can change the maps or
+// write the fields, and checks like CheckBounds whose inputs are all defined
+// outside of the loop.
+//
+// Load elimination already removes such operations from loops when the state
+// before the loop tells it about them, usually thanks to loop peeling. This
+// phase runs afterwards and covers the remaining cases, e.g. loops that
+// couldn't be peeled.
+//
+// Only operations on the straight-line part of the loop's effect chain before
+// the first branch are hoisted, i.e. the ones that are executed in every
+// iteration before the loop can be left. A hoisted check thus only fails if
+// the first iteration would have failed it, too, which avoids deoptimizing
+// loops that aren't entered at all. It deoptimizes to the last checkpoint
+// before the loop entry, so checks are only hoisted if there is such a
+// checkpoint that isn't separated from the loop entry by any side effects.
+class V8_EXPORT_PRIVATE LoopInvariantCodeMotion {
+ public:
+  LoopInvariantCodeMotion(LoopTree* loop_tree, Zone* tmp_zone)
+      : loop_tree_(loop_tree), tmp_zone_(tmp_zone) {}
+
+  void Run();
+
+  // Returns true if a check placed after {effect} can find a frame state to
+  // deoptimize to, i.e. if {effect} is preceded by a checkpoint without any
+  // side effects in between.
+  static bool IsPrecededByCheckpoint(Node* effect);
+
+ private:
+  // What the nodes of a loop may write.
+  struct LoopEffects {
+    explicit LoopEffects(Zone* zone) : field_offsets(zone) {}
+
+    // Set if the loop contains a write that isn't tracked precisely, e.g. a
+    // call.
+    bool writes_all = false;
+    bool writes_maps = false;
+    bool writes_elements_field = false;
+    // The offsets of the fields stored to in the loop, for any object.
+    ZoneSet<int> field_offsets;
+  };
+
+  void ProcessLoop(LoopTree::Loop* loop);
+  void ComputeLoopEffects(LoopTree::Loop* loop, LoopEffects* effects);
+  bool IsInvariant(LoopTree::Loop* loop, Node* node) const;
+  bool CanHoist(LoopTree::Loop* loop, Node* node,
+                const LoopEffects& effects) const;
+  void Hoist(Node* node, Node* loop_node, Node* effect_phi);
+
+  LoopTree* const loop_tree_;
+  Zone* const tmp_zone_;
+  // The nodes hoisted out of the loop that is currently processed. They are
+  // still members of that loop in the {loop_tree_}.
+  ZoneSet<Node*>* hoisted_ = nullptr;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
@@ -27,6 +27,21 @@ void UnrollLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop, uint32_t depth,
       unrolling_count_heuristic(static_cast<uint32_t>(loop->size()), depth);
   if (unrolling_count == 0) return;
 
+  UnrollLoopIterations(loop_node, loop, unrolling_count, graph, common,
+                       tmp_zone, source_positions, node_origins);
+}
+
+void UnrollLoopIterations(Node* loop_node, ZoneUnorderedSet<Node*>* loop,
+                          uint32_t unrolling_count, Graph* graph,
+                          CommonOperatorBuilder* common, Zone* tmp_zone,
+                          SourcePositionTable* source_positions,
+                          NodeOriginTable* node_origins) {
+  DCHECK_EQ(loop_node->opcode(), IrOpcode::kLoop);
+  DCHECK_NOT_NULL(loop);
+  DCHECK_GT(unrolling_count, 0);
+  // No back-jump to the loop header means this is not really a loop.
+  if (loop_node->InputCount() < 2) return;
+
   uint32_t iteration_count = unrolling_count + 1;
 
   uint32_t copied_size = static_cast<uint32_t>(loop->size()) * iteration_count;
@@ -146,7 +161,8 @@ void UnrollLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop, uint32_t depth,
 
       case IrOpcode::kTerminate: {
         // We only need to keep the Terminate node for the loop header of the
-        // first iteration.
+        // first iteration. If it is not part of {loop}, it wasn't copied.
+        if (loop->count(node) == 0) break;
         FOREACH_COPY_INDEX(i) { COPY(node, i)->Kill(); }
         break;
       }
@@ -156,6 +172,18 @@ void UnrollLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop, uint32_t depth,
     }
   }
 
+  // JavaScript stack checks only need to happen in the first iteration, too.
+  for (Node* node : *loop) {
+    if (node->opcode() != IrOpcode::kJSStackCheck) continue;
+    FOREACH_COPY_INDEX(i) {
+      Node* copy = COPY(node, i);
+      NodeProperties::ReplaceUses(copy, nullptr,
+                                  NodeProperties::GetEffectInput(copy),
+                                  NodeProperties::GetControlInput(copy));
+      copy->Kill();
+    }
+  }
+
   /*** Step 3: Rewire the iterations of the loop. Each iteration should flow
        into the next one, and the last should flow into the first. ***/
 
@@ -225,6 +253,71 @@ void UnrollLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop, uint32_t depth,
 #undef COPY
 #undef FOREACH_COPY_INDEX
 
+void TypedArrayLoopUnroller::UnrollInnerLoopsOfTree() {
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    UnrollInnerLoops(loop);
+  }
+}
+
+void TypedArrayLoopUnroller::UnrollInnerLoops(LoopTree::Loop* loop) {
+  if (!loop->children().empty()) {
+    for (LoopTree::Loop* inner_loop : loop->children()) {
+      UnrollInnerLoops(inner_loop);
+    }
+    return;
+  }
+
+  uint32_t size = UnrollableSize(loop);
+  if (size == 0 || size > kMaxUnrolledSize) return;
+  uint32_t unrolling_count =
+      std::min(kMaxUnrolledSize / size, kMaxUnrollingCount);
+
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  if (FLAG_trace_turbo_loop) {
+    PrintF("Unrolling loop with header %i %u times\n", loop_node->id(),
+           unrolling_count);
+  }
+
+  ZoneUnorderedSet<Node*> nodes(tmp_zone_);
+  for (Node* node : loop_tree_->LoopNodes(loop)) nodes.insert(node);
+  UnrollLoopIterations(loop_node, &nodes, unrolling_count, graph_, common_,
+                       tmp_zone_, source_positions_, node_origins_);
+}
+
+uint32_t TypedArrayLoopUnroller::UnrollableSize(LoopTree::Loop* loop) {
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  if (loop_node->InputCount() < 2) return 0;
+  if (!LoopFinder::HasMarkedExits(loop_tree_, loop)) return 0;
+
+  uint32_t size = 0;
+  bool accesses_typed_array = false;
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    switch (node->opcode()) {
+      case IrOpcode::kLoadTypedElement:
+      case IrOpcode::kStoreTypedElement:
+        accesses_typed_array = true;
+        break;
+      case IrOpcode::kFrameState:
+      case IrOpcode::kStateValues:
+      case IrOpcode::kTypedStateValues:
+        // Frame states are copied, but don't end up in the generated code.
+        continue;
+      case IrOpcode::kJSStackCheck:
+        break;
+      case IrOpcode::kCall:
+      case IrOpcode::kIfException:
+        // Calls make the loop overhead negligible anyway.
+        return 0;
+      default:
+        // Generic JavaScript operators may call arbitrary code.
+        if (IrOpcode::IsJsOpcode(node->opcode())) return 0;
+        break;
+    }
+    size++;
+  }
+  return accesses_typed_array ? size : 0;
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
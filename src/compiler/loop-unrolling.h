@@ -37,6 +37,57 @@ void UnrollLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop, uint32_t depth,
                 SourcePositionTable* source_positions,
                 NodeOriginTable* node_origins);
 
+// Like UnrollLoop above, but with an explicit {unrolling_count}, i.e. each
+// iteration of the new loop corresponds to {unrolling_count} + 1 iterations
+// of the initial loop.
+void UnrollLoopIterations(Node* loop_node, ZoneUnorderedSet<Node*>* loop,
+                          uint32_t unrolling_count, Graph* graph,
+                          CommonOperatorBuilder* common, Zone* tmp_zone,
+                          SourcePositionTable* source_positions,
+                          NodeOriginTable* node_origins);
+
+// Unrolls small innermost JavaScript loops that load or store typed array
+// elements, e.g. element-wise arithmetic or copying between typed arrays.
+// Every copy of the body keeps its own exit branch and checks, so the trip
+// count doesn't need to be known. The copies don't repeat the stack check of
+// the loop header, and lay out several iterations of independent element
+// accesses next to each other for the scheduler and register allocator.
+//
+// This runs before loop peeling, while all loop exits are still marked.
+class V8_EXPORT_PRIVATE TypedArrayLoopUnroller {
+ public:
+  TypedArrayLoopUnroller(Graph* graph, CommonOperatorBuilder* common,
+                         LoopTree* loop_tree, Zone* tmp_zone,
+                         SourcePositionTable* source_positions,
+                         NodeOriginTable* node_origins)
+      : graph_(graph),
+        common_(common),
+        loop_tree_(loop_tree),
+        tmp_zone_(tmp_zone),
+        source_positions_(source_positions),
+        node_origins_(node_origins) {}
+
+  void UnrollInnerLoopsOfTree();
+
+  // Loops are only unrolled if they have at most this many nodes, not
+  // counting frame states.
+  static constexpr uint32_t kMaxUnrolledSize = 50;
+  static constexpr uint32_t kMaxUnrollingCount = 3;
+
+ private:
+  void UnrollInnerLoops(LoopTree::Loop* loop);
+  // Returns the size of {loop} without frame states if it can be unrolled,
+  // or 0 otherwise.
+  uint32_t UnrollableSize(LoopTree::Loop* loop);
+
+  Graph* const graph_;
+  CommonOperatorBuilder* const common_;
+  LoopTree* const loop_tree_;
+  Zone* const tmp_zone_;
+  SourcePositionTable* const source_positions_;
+  NodeOriginTable* const node_origins_;
+};
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -387,22 +387,41 @@ void MemoryOptimizer::VisitOtherEffect(Node* node,
 }
 
 MemoryOptimizer::AllocationState const* MemoryOptimizer::MergeStates(
-    AllocationStates const& states) {
+    AllocationStates const& states, Node* effect_phi) {
   // Check if all states are the same; or at least if all allocation
   // states belong to the same allocation group.
   AllocationState const* state = states.front();
   MemoryLowering::AllocationGroup* group = state->group();
+  bool all_open = state->top() != nullptr;
   for (size_t i = 1; i < states.size(); ++i) {
     if (states[i] != state) state = nullptr;
     if (states[i]->group() != group) group = nullptr;
+    if (states[i]->top() == nullptr) all_open = false;
   }
   if (state == nullptr) {
-    if (group != nullptr) {
+    if (group != nullptr && all_open &&
+        FLAG_turbo_allocation_folding_across_merges) {
+      // All inputs still fold into the same group, so we can continue to
+      // fold allocations after the merge: the new top is a Phi of the tops,
+      // and the reservation of the group is extended to the largest size of
+      // all inputs, which leaves the unused part on the other paths free.
+      Node* const control = NodeProperties::GetControlInput(effect_phi);
+      int const input_count = static_cast<int>(states.size());
+      intptr_t size = 0;
+      ZoneVector<Node*> inputs(zone());
+      for (AllocationState const* input_state : states) {
+        size = std::max(size, input_state->size());
+        inputs.push_back(input_state->top());
+      }
+      inputs.push_back(control);
+      Node* top = graph()->NewNode(
+          jsgraph()->common()->Phi(MachineType::PointerRepresentation(),
+                                   input_count),
+          input_count + 1, inputs.data());
+      state = AllocationState::Open(group, size, top, effect_phi, zone());
+    } else if (group != nullptr) {
       // We cannot fold any more allocations into this group, but we can still
       // eliminate write barriers on stores to this group.
-      // TODO(bmeurer): We could potentially just create a Phi here to merge
-      // the various tops; but we need to pay special attention not to create
-      // an unschedulable graph.
       state = AllocationState::Closed(group, nullptr, zone());
     } else {
       // The states are from different allocation groups.
@@ -439,16 +458,21 @@ void MemoryOptimizer::EnqueueMerge(Node* node, int index,
     auto it = pending_.find(id);
     if (it == pending_.end()) {
       // Insert a new pending merge.
-      it = pending_.insert(std::make_pair(id, AllocationStates(zone()))).first;
+      it = pending_
+               .insert(std::make_pair(
+                   id, AllocationStates(input_count, nullptr, zone())))
+               .first;
     }
-    // Add the next input state.
-    it->second.push_back(state);
+    // Add the next input state, in the order of the inputs.
+    DCHECK_NULL(it->second[index]);
+    it->second[index] = state;
     // Check if states for all inputs are available by now.
-    if (it->second.size() == static_cast<size_t>(input_count)) {
+    if (std::find(it->second.begin(), it->second.end(), nullptr) ==
+        it->second.end()) {
       // All inputs to this effect merge are done, merge the states given all
       // input constraints, drop the pending merge and enqueue uses of the
       // EffectPhi {node}.
-      state = MergeStates(it->second);
+      state = MergeStates(it->second, node);
       EnqueueUses(node, state);
       pending_.erase(it);
     }
@@ -79,11 +79,17 @@ void PipelineStatistics::BeginPhaseKind(const char* phase_kind_name) {
   phase_kind_stats_.Begin(this);
 }
 
+std::string PipelineStatistics::StatsName(const char* name) const {
+  if (!reduced_optimization_) return name;
+  return std::string(name) + ".Reduced";
+}
+
 void PipelineStatistics::EndPhaseKind() {
   DCHECK(!InPhase());
   CompilationStatistics::BasicStats diff;
   phase_kind_stats_.End(this, &diff);
-  compilation_stats_->RecordPhaseKindStats(phase_kind_name_, diff);
+  compilation_stats_->RecordPhaseKindStats(
+      StatsName(phase_kind_name_).c_str(), diff);
   TRACE_EVENT_END2(kTraceCategory, phase_kind_name_, "kind",
                    CodeKindToString(code_kind_), "stats",
                    TRACE_STR_COPY(diff.AsJSON().c_str()));
@@ -101,7 +107,8 @@ void PipelineStatistics::EndPhase() {
   DCHECK(InPhaseKind());
   CompilationStatistics::BasicStats diff;
   phase_stats_.End(this, &diff);
-  compilation_stats_->RecordPhaseStats(phase_kind_name_, phase_name_, diff);
+  compilation_stats_->RecordPhaseStats(StatsName(phase_kind_name_).c_str(),
+                                       StatsName(phase_name_).c_str(), diff);
   TRACE_EVENT_END2(kTraceCategory, phase_name_, "kind",
                    CodeKindToString(code_kind_), "stats",
                    TRACE_STR_COPY(diff.AsJSON().c_str()));
@@ -31,6 +31,10 @@ class PipelineStatistics : public Malloced {
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind();
 
+  // Records the phases of this compilation under separate names, for
+  // compilations with the reduced optimization level.
+  void set_reduced_optimization() { reduced_optimization_ = true; }
+
   // We log detailed phase information about the pipeline
   // in both the v8.turbofan and the v8.wasm.turbofan categories.
   static constexpr char kTraceCategory[] =
@@ -60,6 +64,8 @@ class PipelineStatistics : public Malloced {
 
   bool InPhaseKind() { return !!phase_kind_stats_.scope_; }
 
+  std::string StatsName(const char* name) const;
+
   friend class PhaseScope;
   bool InPhase() { return !!phase_stats_.scope_; }
   void BeginPhase(const char* name);
@@ -70,6 +76,7 @@ class PipelineStatistics : public Malloced {
   CompilationStatistics* compilation_stats_;
   CodeKind code_kind_;
   std::string function_name_;
+  bool reduced_optimization_ = false;
 
   // Stats for the entire compilation.
   CommonStats total_stats_;
@@ -29,6 +29,7 @@
 #include "src/compiler/backend/register-allocator.h"
 #include "src/compiler/basic-block-instrumentor.h"
 #include "src/compiler/branch-condition-duplicator.h"
+#include "src/compiler/bounds-check-elimination.h"
 #include "src/compiler/branch-elimination.h"
 #include "src/compiler/bytecode-graph-builder.h"
 #include "src/compiler/checkpoint-elimination.h"
@@ -57,6 +58,7 @@
 #include "src/compiler/js-typed-lowering.h"
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-invariant-code-motion.h"
 #include "src/compiler/loop-peeling.h"
 #include "src/compiler/loop-unrolling.h"
 #include "src/compiler/loop-variable-optimizer.h"
@@ -1156,7 +1158,11 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
   if (!FLAG_always_opt) {
     compilation_info()->set_bailout_on_uninitialized();
   }
-  if (FLAG_turbo_loop_peeling) {
+  if (compilation_info()->reduced_optimization()) {
+    // Record the phases of the cheaper pipeline separately, so that both
+    // optimization levels can be compared with --turbo-stats.
+    if (pipeline_statistics_) pipeline_statistics_->set_reduced_optimization();
+  } else if (FLAG_turbo_loop_peeling) {
     compilation_info()->set_loop_peeling();
   }
   if (FLAG_turbo_inlining) {
@@ -1314,6 +1320,9 @@ struct GraphBuilderPhase {
     if (data->info()->bailout_on_uninitialized()) {
       flags |= BytecodeGraphBuilderFlag::kBailoutOnUninitialized;
     }
+    if (data->info()->reduced_optimization()) {
+      flags |= BytecodeGraphBuilderFlag::kReducedOptimization;
+    }
 
     JSFunctionRef closure = MakeRef(data->broker(), data->info()->closure());
     CallFrequency frequency(1.0f);
@@ -1615,6 +1624,64 @@ struct LoopPeelingPhase {
   }
 };
 
+struct LoopUnrollingPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopUnrolling)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    {
+      UnparkedScopeIfNeeded scope(data->broker(), FLAG_trace_turbo_trimming);
+      trimmer.TrimGraph(roots.begin(), roots.end());
+    }
+
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
+        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    TypedArrayLoopUnroller(data->graph(), data->common(), loop_tree, temp_zone,
+                           data->source_positions(), data->node_origins())
+        .UnrollInnerLoopsOfTree();
+  }
+};
+
+struct LoopInvariantCodeMotionPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopInvariantCodeMotion)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    {
+      UnparkedScopeIfNeeded scope(data->broker(), FLAG_trace_turbo_trimming);
+      trimmer.TrimGraph(roots.begin(), roots.end());
+    }
+
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
+        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    LoopInvariantCodeMotion(loop_tree, temp_zone).Run();
+  }
+};
+
+struct BoundsCheckEliminationPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(BoundsCheckElimination)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    {
+      UnparkedScopeIfNeeded scope(data->broker(), FLAG_trace_turbo_trimming);
+      trimmer.TrimGraph(roots.begin(), roots.end());
+    }
+
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
+        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    // The typer inspects heap objects when typing the new nodes.
+    UnparkedScopeIfNeeded scope(data->broker());
+    BoundsCheckElimination(data->jsgraph(), loop_tree, temp_zone).Run();
+  }
+};
+
 #if V8_ENABLE_WEBASSEMBLY
 struct WasmInliningPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(WasmInlining)
@@ -2705,6 +2772,10 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   RunPrintAndVerify(TypedLoweringPhase::phase_name());
 
   if (data->info()->loop_peeling()) {
+    if (FLAG_turbo_loop_unrolling) {
+      Run<LoopUnrollingPhase>();
+      RunPrintAndVerify(LoopUnrollingPhase::phase_name(), true);
+    }
     Run<LoopPeelingPhase>();
     RunPrintAndVerify(LoopPeelingPhase::phase_name(), true);
   } else {
@@ -2716,9 +2787,19 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
+
+  if (FLAG_turbo_loop_invariant_code_motion) {
+    Run<LoopInvariantCodeMotionPhase>();
+    RunPrintAndVerify(LoopInvariantCodeMotionPhase::phase_name(), true);
+  }
+
+  if (FLAG_turbo_bounds_check_elimination) {
+    Run<BoundsCheckEliminationPhase>();
+    RunPrintAndVerify(BoundsCheckEliminationPhase::phase_name());
+  }
   data->DeleteTyper();
 
-  if (FLAG_turbo_escape) {
+  if (FLAG_turbo_escape && !data->info()->reduced_optimization()) {
     Run<EscapeAnalysisPhase>();
     if (data->compilation_failed()) {
       info()->AbortOptimization(
@@ -3489,6 +3570,7 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   bool use_mid_tier_register_allocator =
       !CodeKindIsStaticallyCompiled(data->info()->code_kind()) &&
       (FLAG_turbo_force_mid_tier_regalloc ||
+       data->info()->reduced_optimization() ||
        (FLAG_turbo_use_mid_tier_regalloc_for_huge_functions &&
         data->sequence()->VirtualRegisterCount() >
             kTopTierVirtualRegistersLimit));
@@ -171,25 +171,39 @@ class NamedAccessFeedback : public ProcessedFeedback {
 
 class CallFeedback : public ProcessedFeedback {
  public:
+  // A target from the call target profile of a megamorphic call site, with
+  // the share of the profiled calls that went to it.
+  struct ProfiledTarget {
+    JSFunctionRef function;
+    float share;
+  };
+
   CallFeedback(base::Optional<HeapObjectRef> target, float frequency,
                SpeculationMode mode, CallFeedbackContent call_feedback_content,
+               ZoneVector<ProfiledTarget> profiled_targets,
                FeedbackSlotKind slot_kind)
       : ProcessedFeedback(kCall, slot_kind),
         target_(target),
         frequency_(frequency),
         mode_(mode),
-        content_(call_feedback_content) {}
+        content_(call_feedback_content),
+        profiled_targets_(std::move(profiled_targets)) {}
 
   base::Optional<HeapObjectRef> target() const { return target_; }
   float frequency() const { return frequency_; }
   SpeculationMode speculation_mode() const { return mode_; }
   CallFeedbackContent call_feedback_content() const { return content_; }
+  // Sorted by decreasing share.
+  ZoneVector<ProfiledTarget> const& profiled_targets() const {
+    return profiled_targets_;
+  }
 
  private:
   base::Optional<HeapObjectRef> const target_;
   float const frequency_;
   SpeculationMode const mode_;
   CallFeedbackContent const content_;
+  ZoneVector<ProfiledTarget> const profiled_targets_;
 };
 
 template <class T, ProcessedFeedback::Kind K>
@@ -16,6 +16,7 @@
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/diamond.h"
+#include "src/compiler/fast-api-calls.h"
 #include "src/compiler/graph-visualizer.h"
 #include "src/compiler/js-heap-broker.h"
 #include "src/compiler/linkage.h"
@@ -1900,6 +1901,8 @@ class RepresentationSelector {
           case CTypeInfo::Type::kFloat64:
             return UseInfo::CheckedNumberAsFloat64(kDistinguishZeros, feedback);
           case CTypeInfo::Type::kV8Value:
+          case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString:
           case CTypeInfo::Type::kApiObject:
             return UseInfo::AnyTagged();
         }
@@ -1919,15 +1922,41 @@ class RepresentationSelector {
 
   static constexpr int kInitialArgumentsCount = 10;
 
+  // Drops the overloads of a FastApiCall that don't fit the types of its
+  // arguments, so that e.g. an int32 and a float64 overload can be told apart
+  // by the type of a number argument.
+  void SelectFastApiCallOverloads(Node* node) {
+    FastApiCallParameters const& op_params =
+        FastApiCallParametersOf(node->op());
+    const FastApiCallFunctionVector& c_functions = op_params.c_functions();
+    if (c_functions.size() < 2) return;
+
+    // All overloads have the same number of arguments.
+    const int c_arg_count = c_functions[0].signature->ArgumentCount();
+    base::SmallVector<Type, kInitialArgumentsCount> arg_types(c_arg_count);
+    for (int i = 0; i < c_arg_count; i++) {
+      arg_types[i] = TypeOf(node->InputAt(i));
+    }
+    FastApiCallFunctionVector selected = fast_api_call::SelectOverloadsByType(
+        graph()->zone(), c_functions,
+        base::VectorOf(arg_types.data(), arg_types.size()));
+    if (selected.size() == c_functions.size()) return;
+
+    ChangeOp(node, simplified()->FastApiCall(selected, op_params.feedback(),
+                                             op_params.descriptor()));
+  }
+
   template <Phase T>
   void VisitFastApiCall(Node* node, SimplifiedLowering* lowering) {
+    if (propagate<T>()) SelectFastApiCallOverloads(node);
+
     FastApiCallParameters const& op_params =
         FastApiCallParametersOf(node->op());
     // We only consider the first function signature here. In case of function
-    // overloads, we only support the case of two functions that differ for one
-    // argument, which must be a JSArray in one function and a TypedArray in the
-    // other function, and both JSArrays and TypedArrays have the same UseInfo
-    // UseInfo::AnyTagged(). All the other argument types must match.
+    // overloads that remain after SelectFastApiCallOverloads, we only support
+    // the case of functions that differ for one argument, which must be a
+    // JSArray, a TypedArray or a v8::Value, and all of these have the same
+    // UseInfo UseInfo::AnyTagged(). All the other argument types must match.
     const CFunctionInfo* c_signature = op_params.c_functions()[0].signature;
     const int c_arg_count = c_signature->ArgumentCount();
     CallDescriptor* call_descriptor = op_params.descriptor();
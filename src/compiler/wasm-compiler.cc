@@ -7701,6 +7701,11 @@ static MachineRepresentation NormalizeFastApiRepresentation(
   return t.representation();
 }
 
+static bool IsFastApiStringType(const CTypeInfo& info) {
+  return info.GetType() == CTypeInfo::Type::kSeqOneByteString ||
+         info.GetType() == CTypeInfo::Type::kSeqTwoByteString;
+}
+
 static bool IsSupportedWasmFastApiFunction(
     const wasm::FunctionSig* expected_sig, Handle<SharedFunctionInfo> shared) {
   if (!shared->IsApiFunction()) {
@@ -7746,6 +7751,11 @@ static bool IsSupportedWasmFastApiFunction(
     return false;
   }
   CTypeInfo return_info = info->ReturnInfo();
+  // Strings have no Wasm representation.
+  if (IsFastApiStringType(return_info)) {
+    log_imported_function_mismatch();
+    return false;
+  }
   // Unsupported if return type doesn't match.
   if (expected_sig->return_count() == 0 &&
       return_info.GetType() != CTypeInfo::Type::kVoid) {
@@ -7774,7 +7784,8 @@ static bool IsSupportedWasmFastApiFunction(
     // Arg 0 is the receiver, skip over it since wasm doesn't
     // have a concept of receivers.
     CTypeInfo arg = info->ArgumentInfo(i + 1);
-    if (NormalizeFastApiRepresentation(arg) !=
+    if (IsFastApiStringType(arg) ||
+        NormalizeFastApiRepresentation(arg) !=
         expected_sig->GetParam(i).machine_type().representation()) {
       log_imported_function_mismatch();
       return false;
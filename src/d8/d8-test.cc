@@ -456,6 +456,58 @@ class FastCApiObject {
     args.GetReturnValue().Set(Number::New(isolate, sum));
   }
 
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType AddOptionalInt32FastCallbackPatch(AnyCType receiver,
+                                                    AnyCType should_fallback,
+                                                    AnyCType arg_i32,
+                                                    AnyCType optional_arg,
+                                                    AnyCType options) {
+    AnyCType ret;
+    ret.int32_value = AddOptionalInt32FastCallback(
+        receiver.object_value, should_fallback.bool_value, arg_i32.int32_value,
+        optional_arg.object_value, *options.options_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  static int AddOptionalInt32FastCallback(Local<Object> receiver,
+                                          bool should_fallback,
+                                          int32_t arg_i32,
+                                          Local<Value> optional_arg,
+                                          FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    if (should_fallback) {
+      options.fallback = true;
+      return 0;
+    }
+
+    if (!optional_arg->IsInt32()) return arg_i32;
+    return arg_i32 + optional_arg.As<Int32>()->Value();
+  }
+  static void AddOptionalInt32SlowCallback(
+      const FunctionCallbackInfo<Value>& args) {
+    Isolate* isolate = args.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    double sum = 0;
+    if (args.Length() > 1 && args[1]->IsNumber()) {
+      sum += args[1]->Int32Value(isolate->GetCurrentContext()).FromJust();
+    }
+    if (args.Length() > 2 && args[2]->IsInt32()) {
+      sum += args[2].As<Int32>()->Value();
+    }
+
+    args.GetReturnValue().Set(Number::New(isolate, sum));
+  }
+
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
   static AnyCType AddAll32BitIntFastCallback_6ArgsPatch(
       AnyCType receiver, AnyCType should_fallback, AnyCType arg1_i32,
@@ -540,6 +592,99 @@ class FastCApiObject {
     args.GetReturnValue().Set(Number::New(isolate, sum));
   }
 
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType CopyStringFastCallbackPatch(AnyCType receiver,
+                                              AnyCType should_fallback,
+                                              AnyCType string,
+                                              AnyCType options) {
+    AnyCType ret;
+    ret.one_byte_string_value = CopyStringFastCallback(
+        receiver.object_value, should_fallback.bool_value,
+        *string.one_byte_string_value, *options.options_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  static const FastOneByteString* CopyStringFastCallback(
+      Local<Object> receiver, bool should_fallback,
+      const FastOneByteString& string, FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(nullptr);
+    self->fast_call_count_++;
+
+    if (should_fallback) {
+      options.fallback = true;
+      return nullptr;
+    }
+
+    // The result has to outlive the call, so keep a copy of the characters.
+    static thread_local std::string copy;
+    static thread_local FastOneByteString result;
+    copy.assign(string.data, string.length);
+    result = {copy.data(), static_cast<uint32_t>(copy.size())};
+    return &result;
+  }
+  static void CopyStringSlowCallback(const FunctionCallbackInfo<Value>& args) {
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    if (args.Length() < 2 || !args[1]->IsString()) {
+      args.GetIsolate()->ThrowError("copy_string expects a string argument");
+      return;
+    }
+    args.GetReturnValue().Set(args[1]);
+  }
+
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType SumTwoByteCharCodesFastCallbackPatch(AnyCType receiver,
+                                                       AnyCType should_fallback,
+                                                       AnyCType string,
+                                                       AnyCType options) {
+    AnyCType ret;
+    ret.uint32_value = SumTwoByteCharCodesFastCallback(
+        receiver.object_value, should_fallback.bool_value,
+        *string.two_byte_string_value, *options.options_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  static uint32_t SumTwoByteCharCodesFastCallback(
+      Local<Object> receiver, bool should_fallback,
+      const FastTwoByteString& string, FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    if (should_fallback) {
+      options.fallback = true;
+      return 0;
+    }
+
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < string.length; i++) sum += string.data[i];
+    return sum;
+  }
+  static void SumTwoByteCharCodesSlowCallback(
+      const FunctionCallbackInfo<Value>& args) {
+    Isolate* isolate = args.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    if (args.Length() < 2 || !args[1]->IsString()) {
+      isolate->ThrowError("sum_two_byte_char_codes expects a string argument");
+      return;
+    }
+    String::Value value(isolate, args[1]);
+    uint32_t sum = 0;
+    for (int i = 0; i < value.length(); i++) sum += (*value)[i];
+    args.GetReturnValue().Set(Number::New(isolate, sum));
+  }
+
   static bool IsFastCApiObjectFastCallback(v8::Local<v8::Object> receiver,
                                            bool should_fallback,
                                            v8::Local<v8::Value> arg,
@@ -792,6 +937,18 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             signature, 1, ConstructorBehavior::kThrow,
             SideEffectType::kHasSideEffect, {add_all_overloads, 2}));
 
+    const CFunction add_all_overloads_by_kind[] = {
+        add_all_int32_typed_array_c_func,
+        add_all_float64_typed_array_c_func,
+        add_all_seq_c_func,
+    };
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_overload_by_kind",
+        FunctionTemplate::NewWithCFunctionOverloads(
+            isolate, FastCApiObject::AddAllSequenceSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, {add_all_overloads_by_kind, 3}));
+
     CFunction add_all_int_invalid_func =
         CFunction::Make(FastCApiObject::AddAllIntInvalidCallback);
     const CFunction add_all_invalid_overloads[] = {
@@ -841,6 +998,36 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             signature, 1, ConstructorBehavior::kThrow,
             SideEffectType::kHasSideEffect, &add_32bit_int_c_func));
 
+    CFunction add_optional_int32_c_func = CFunction::Make(
+        FastCApiObject::AddOptionalInt32FastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::AddOptionalInt32FastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_optional_int32",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddOptionalInt32SlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_optional_int32_c_func));
+
+    CFunction copy_string_c_func = CFunction::Make(
+        FastCApiObject::CopyStringFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::CopyStringFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "copy_string",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::CopyStringSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &copy_string_c_func));
+
+    CFunction sum_two_byte_char_codes_c_func = CFunction::Make(
+        FastCApiObject::SumTwoByteCharCodesFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::SumTwoByteCharCodesFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "sum_two_byte_char_codes",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::SumTwoByteCharCodesSlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &sum_two_byte_char_codes_c_func));
+
     CFunction is_valid_api_object_c_func =
         CFunction::Make(FastCApiObject::IsFastCApiObjectFastCallback);
     api_obj_ctor->PrototypeTemplate()->Set(
@@ -54,6 +54,7 @@ namespace internal {
   V(OutOfBounds, "out of bounds")                                              \
   V(Overflow, "overflow")                                                      \
   V(Smi, "Smi")                                                                \
+  V(TierUpToFullOptimization, "tier up to full optimization")                  \
   V(TransitionedToMonomorphicIC, "IC transitioned to monomorphic")             \
   V(TransitionedToMegamorphicIC, "IC transitioned to megamorphic")             \
   V(Unknown, "(unknown)")                                                      \
@@ -559,6 +559,10 @@ Handle<Code> Deoptimizer::compiled_code() const {
   return Handle<Code>(compiled_code_, isolate());
 }
 
+DeoptimizeReason Deoptimizer::deopt_reason() const {
+  return GetDeoptInfo(compiled_code_, from_).deopt_reason;
+}
+
 Deoptimizer::~Deoptimizer() {
   DCHECK(input_ == nullptr && output_ == nullptr);
   DCHECK_NULL(disallow_garbage_collection_);
@@ -55,6 +55,7 @@
 #include "src/execution/protectors-inl.h"
 #include "src/execution/simulator.h"
 #include "src/execution/tiering-manager.h"
+#include "src/execution/tiering-profile.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles-inl.h"
@@ -3338,6 +3339,9 @@ bool Isolate::LogObjectRelocation() {
 
 void Isolate::Deinit() {
   TRACE_ISOLATE(deinit);
+  if (FLAG_tiering_profile_output != nullptr) {
+    tiering_profile_->Write(tiering_profile_->OutputFileName().c_str());
+  }
   DisallowHeapAllocation no_allocation;
 
   tracing_cpu_profiler_.reset();
@@ -3434,6 +3438,8 @@ void Isolate::Deinit() {
     delete tiering_manager_;
     tiering_manager_ = nullptr;
   }
+  delete tiering_profile_;
+  tiering_profile_ = nullptr;
 
   delete heap_profiler_;
   heap_profiler_ = nullptr;
@@ -4094,6 +4100,13 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   // Initialize before deserialization since collections may occur,
   // clearing/updating ICs (and thus affecting tiering decisions).
   tiering_manager_ = new TieringManager(this);
+  if (FLAG_tiering_profile_input != nullptr ||
+      FLAG_tiering_profile_output != nullptr) {
+    tiering_profile_ = new TieringProfile(this);
+    if (FLAG_tiering_profile_input != nullptr) {
+      tiering_profile_->Load(FLAG_tiering_profile_input);
+    }
+  }
 
   // If we are deserializing, read the state into the now-empty heap.
   {
@@ -134,6 +134,7 @@ class ThreadManager;
 class ThreadState;
 class ThreadVisitor;  // Defined in v8threads.h
 class TieringManager;
+class TieringProfile;
 class TracingCpuProfilerImpl;
 class UnicodeCache;
 struct ManagedPtrDestructor;
@@ -1110,6 +1111,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return metrics_recorder_;
   }
   TieringManager* tiering_manager() { return tiering_manager_; }
+  // Null unless --tiering-profile-input or --tiering-profile-output is set.
+  TieringProfile* tiering_profile() { return tiering_profile_; }
   CompilationCache* compilation_cache() { return compilation_cache_; }
   V8FileLogger* logger() {
     // Call InitializeLoggingAndCounters() if logging is needed before
@@ -2089,6 +2092,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Address isolate_addresses_[kIsolateAddressCount + 1] = {};
   Bootstrapper* bootstrapper_ = nullptr;
   TieringManager* tiering_manager_ = nullptr;
+  TieringProfile* tiering_profile_ = nullptr;
   CompilationCache* compilation_cache_ = nullptr;
   std::shared_ptr<Counters> async_counters_;
   base::RecursiveMutex break_access_;
@@ -11,6 +11,7 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
+#include "src/deoptimizer/deoptimize-reason.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
@@ -30,7 +31,8 @@ static const int kOSRBytecodeSizeAllowancePerTick = 44;
 #define OPTIMIZATION_REASON_LIST(V)   \
   V(DoNotOptimize, "do not optimize") \
   V(HotAndStable, "hot and stable")   \
-  V(SmallFunction, "small function")
+  V(SmallFunction, "small function")  \
+  V(OptimizationHint, "optimization hint")
 
 enum class OptimizationReason : uint8_t {
 #define OPTIMIZATION_REASON_CONSTANTS(Constant, message) k##Constant,
@@ -70,6 +72,10 @@ class OptimizationDecision {
     return {OptimizationReason::kSmallFunction, CodeKind::TURBOFAN,
             ConcurrencyMode::kConcurrent};
   }
+  static constexpr OptimizationDecision TurbofanOptimizationHint() {
+    return {OptimizationReason::kOptimizationHint, CodeKind::TURBOFAN,
+            ConcurrencyMode::kConcurrent};
+  }
   static constexpr OptimizationDecision DoNotOptimize() {
     return {OptimizationReason::kDoNotOptimize,
             // These values don't matter but we have to pass something.
@@ -202,6 +208,19 @@ int TieringManager::InitialInterruptBudget() {
              : FLAG_interrupt_budget;
 }
 
+// static
+bool TieringManager::UseReducedTurbofanPipeline(JSFunction function,
+                                                bool is_osr) {
+  if (V8_LIKELY(!FLAG_turbo_adaptive_optimization_level)) return false;
+  // OSR code is entered from a hot loop, and hinted functions were hot in a
+  // previous run, so both are likely to run long enough to pay off the full
+  // pipeline.
+  if (is_osr || function.shared().has_optimization_hint()) return false;
+  if (!function.has_feedback_vector()) return false;
+  return function.feedback_vector().invocation_count() <
+         FLAG_turbo_full_optimization_invocation_count;
+}
+
 namespace {
 
 bool SmallEnoughForOSR(Isolate* isolate, JSFunction function) {
@@ -267,8 +286,170 @@ bool ShouldOptimizeAsSmallFunction(int bytecode_size, bool any_ic_changed) {
          bytecode_size < FLAG_max_bytecode_size_for_early_opt;
 }
 
+// The number of eager deopts of a function since it got into a deoptimization
+// loop, or 0 if it isn't in one.
+int DeoptLoopCount(FeedbackVector vector) {
+  if (FLAG_deopt_loop_threshold <= 0) return 0;
+  return std::max(0, vector.deopt_count() - FLAG_deopt_loop_threshold + 1);
+}
+
+// Returns the kind of the feedback slot of {bytecode} if ConfigureGeneric()
+// supports it, or kInvalid otherwise. All these bytecodes take the feedback
+// slot as their last operand.
+FeedbackSlotKind GenericFeedbackSlotKindOf(interpreter::Bytecode bytecode) {
+  using interpreter::Bytecode;
+  switch (bytecode) {
+    case Bytecode::kAdd:
+    case Bytecode::kSub:
+    case Bytecode::kMul:
+    case Bytecode::kDiv:
+    case Bytecode::kMod:
+    case Bytecode::kExp:
+    case Bytecode::kBitwiseOr:
+    case Bytecode::kBitwiseXor:
+    case Bytecode::kBitwiseAnd:
+    case Bytecode::kShiftLeft:
+    case Bytecode::kShiftRight:
+    case Bytecode::kShiftRightLogical:
+    case Bytecode::kAddSmi:
+    case Bytecode::kSubSmi:
+    case Bytecode::kMulSmi:
+    case Bytecode::kDivSmi:
+    case Bytecode::kModSmi:
+    case Bytecode::kExpSmi:
+    case Bytecode::kBitwiseOrSmi:
+    case Bytecode::kBitwiseXorSmi:
+    case Bytecode::kBitwiseAndSmi:
+    case Bytecode::kShiftLeftSmi:
+    case Bytecode::kShiftRightSmi:
+    case Bytecode::kShiftRightLogicalSmi:
+    case Bytecode::kInc:
+    case Bytecode::kDec:
+    case Bytecode::kNegate:
+    case Bytecode::kBitwiseNot:
+      return FeedbackSlotKind::kBinaryOp;
+    case Bytecode::kTestEqual:
+    case Bytecode::kTestEqualStrict:
+    case Bytecode::kTestLessThan:
+    case Bytecode::kTestGreaterThan:
+    case Bytecode::kTestLessThanOrEqual:
+    case Bytecode::kTestGreaterThanOrEqual:
+      return FeedbackSlotKind::kCompareOp;
+    case Bytecode::kCallAnyReceiver:
+    case Bytecode::kCallProperty:
+    case Bytecode::kCallProperty0:
+    case Bytecode::kCallProperty1:
+    case Bytecode::kCallProperty2:
+    case Bytecode::kCallUndefinedReceiver:
+    case Bytecode::kCallUndefinedReceiver0:
+    case Bytecode::kCallUndefinedReceiver1:
+    case Bytecode::kCallUndefinedReceiver2:
+    case Bytecode::kCallWithSpread:
+    case Bytecode::kConstruct:
+    case Bytecode::kConstructWithSpread:
+      return FeedbackSlotKind::kCall;
+    default:
+      return FeedbackSlotKind::kInvalid;
+  }
+}
+
+// Makes the feedback of the operation at the current bytecode of {frame}
+// generic, if it has BinaryOp, CompareOp or Call feedback.
+bool ConfigureGenericFeedbackAtCurrentBytecode(Isolate* isolate,
+                                               UnoptimizedFrame* frame) {
+  JSFunction function = frame->function();
+  if (!function.has_feedback_vector()) return false;
+  FeedbackVector vector = function.feedback_vector();
+  interpreter::BytecodeArrayIterator iterator(
+      handle(frame->GetBytecodeArray(), isolate), frame->GetBytecodeOffset());
+  interpreter::Bytecode bytecode = iterator.current_bytecode();
+  FeedbackSlotKind kind = GenericFeedbackSlotKindOf(bytecode);
+  if (kind == FeedbackSlotKind::kInvalid) return false;
+  int slot_operand = interpreter::Bytecodes::NumberOfOperands(bytecode) - 1;
+  DCHECK_EQ(interpreter::Bytecodes::GetOperandType(bytecode, slot_operand),
+            interpreter::OperandType::kIdx);
+  FeedbackSlot slot = iterator.GetSlotOperand(slot_operand);
+  if (slot.ToInt() >= vector.length()) return false;
+  FeedbackNexus nexus(vector, slot);
+  if (nexus.kind() != kind) return false;
+  return nexus.ConfigureGeneric();
+}
+
+// Deopts for missing feedback don't mean that speculation failed; the
+// interpreter collects the feedback when execution continues there.
+bool IsInsufficientFeedback(DeoptimizeReason reason) {
+  switch (reason) {
+    case DeoptimizeReason::kInsufficientTypeFeedbackForCall:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForConstruct:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForForIn:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForBinaryOperation:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForCompareOperation:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForGenericNamedAccess:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForGenericKeyedAccess:
+    case DeoptimizeReason::kInsufficientTypeFeedbackForUnaryOperation:
+      return true;
+    default:
+      return false;
+  }
+}
+
 }  // namespace
 
+void TieringManager::OnEagerDeopt(JSFunction function, JavaScriptFrame* frame,
+                                  DeoptimizeReason reason) {
+  if (!function.has_feedback_vector()) return;
+  if (reason == DeoptimizeReason::kTierUpToFullOptimization) {
+    // Code compiled at the reduced optimization level bails out once the
+    // function got hot. That is no failed speculation, so just recompile the
+    // function at the full level.
+    DCHECK(!UseReducedTurbofanPipeline(function, false));
+    if (!function.shared().optimization_disabled()) {
+      Optimize(function, OptimizationDecision::TurbofanHotAndStable());
+    }
+    return;
+  }
+  if (IsInsufficientFeedback(reason)) return;
+  // Eager deopts continue at the operation whose speculation failed, unless
+  // they continue in a builtin, e.g. for a callback of an inlined
+  // Array.prototype.map, where the failed call already disallowed speculation
+  // through its deopt exit. Such deopts aren't counted.
+  if (!frame->is_unoptimized()) return;
+  UnoptimizedFrame* unoptimized_frame = UnoptimizedFrame::cast(frame);
+  FeedbackVector vector = function.feedback_vector();
+  vector.set_deoptimized_since_optimization(true);
+  // The bytecode offset is only meaningful for the bytecode of {function};
+  // deopts in inlined functions aren't counted.
+  if (frame->function() != function) return;
+
+  // Only deopts at the same site in a row form a deoptimization loop; a deopt
+  // elsewhere means that the feedback at the previous site has settled.
+  const int bytecode_offset = unoptimized_frame->GetBytecodeOffset();
+  if (vector.last_deopt_bytecode_offset() != bytecode_offset) {
+    vector.set_last_deopt_bytecode_offset(bytecode_offset);
+    vector.set_deopt_count(0);
+  }
+  vector.SaturatingIncrementDeoptCount();
+  const int deopt_loop_count = DeoptLoopCount(vector);
+  if (deopt_loop_count == 0) return;
+  if (deopt_loop_count == 1) isolate_->counters()->deopt_loops()->Increment();
+
+  const bool feedback_updated =
+      ConfigureGenericFeedbackAtCurrentBytecode(isolate_, unoptimized_frame);
+  if (V8_UNLIKELY(FLAG_trace_deopt_loops)) {
+    CodeTracer::Scope scope(isolate_->GetCodeTracer());
+    PrintF(scope.file(), "[deoptimization loop in ");
+    function.ShortPrint(scope.file());
+    PrintF(scope.file(), ": %d deopts, reason: %s", vector.deopt_count(),
+           DeoptimizeReasonToString(reason));
+    if (feedback_updated) {
+      PrintF(scope.file(), ", made feedback generic at %s:%d",
+             unoptimized_frame->function().DebugNameCStr().get(),
+             unoptimized_frame->GetBytecodeOffset());
+    }
+    PrintF(scope.file(), "]\n");
+  }
+}
+
 void TieringManager::RequestOsrAtNextOpportunity(JSFunction function) {
   DisallowGarbageCollection no_gc;
   TryRequestOsrAtNextOpportunity(isolate_, function);
@@ -316,7 +497,17 @@ void TieringManager::MaybeOptimizeFrame(JSFunction function,
     // OSR kicks in only once we've previously decided to tier up, but we are
     // still in the unoptimized frame (this implies a long-running loop).
     if (SmallEnoughForOSR(isolate_, function)) {
-      TryIncrementOsrUrgency(isolate_, function);
+      if (V8_UNLIKELY(FLAG_maglev) &&
+          function.HasAvailableCodeKind(CodeKind::MAGLEV)) {
+        // There is no OSR into Maglev code. An unoptimized frame that keeps
+        // ticking after Maglev code became available is in a long-running
+        // loop that only Turbofan OSR can move to optimized code, so request
+        // OSR at the next back edge of any loop instead of raising the
+        // urgency by one loop level per tick.
+        TryRequestOsrAtNextOpportunity(isolate_, function);
+      } else {
+        TryIncrementOsrUrgency(isolate_, function);
+      }
     }
 
     // Return unconditionally and don't run through the optimization decision
@@ -345,11 +536,29 @@ OptimizationDecision TieringManager::ShouldOptimize(JSFunction function,
 
   BytecodeArray bytecode = function.shared().GetBytecodeArray(isolate_);
   const int ticks = function.feedback_vector().profiler_ticks();
+  // Functions in a deoptimization loop wait for more ticks with every deopt,
+  // to give their feedback time to settle.
+  const int deopt_loop_count = DeoptLoopCount(function.feedback_vector());
   const int ticks_for_optimization =
-      FLAG_ticks_before_optimization +
+      FLAG_ticks_before_optimization * (1 + deopt_loop_count) +
       (bytecode.length() / FLAG_bytecode_size_allowance_per_tick);
   if (ticks >= ticks_for_optimization) {
     return OptimizationDecision::TurbofanHotAndStable();
+  } else if (deopt_loop_count > 0) {
+    if (FLAG_trace_opt_verbose) {
+      PrintF(
+          "[not yet optimizing %s, not enough ticks: %d/%d and in a "
+          "deoptimization loop]\n",
+          function.DebugNameCStr().get(), ticks, ticks_for_optimization);
+    }
+  } else if (V8_UNLIKELY(FLAG_code_cache_optimization_hints ||
+                         FLAG_tiering_profile_input != nullptr) &&
+             function.shared().has_optimization_hint()) {
+    // The function was optimized in the run that produced the code cache or
+    // the tiering profile, so don't wait for it to become hot again. The first
+    // tick still happens only after feedback has been collected for a full
+    // interrupt budget.
+    return OptimizationDecision::TurbofanOptimizationHint();
   } else if (ShouldOptimizeAsSmallFunction(bytecode.length(),
                                            any_ic_changed_)) {
     // If no IC was patched since the last tick and this function is very
@@ -19,6 +19,7 @@ class JavaScriptFrame;
 class JSFunction;
 class OptimizationDecision;
 enum class CodeKind : uint8_t;
+enum class DeoptimizeReason : uint8_t;
 enum class OptimizationReason : uint8_t;
 
 void TraceManualRecompile(JSFunction function, CodeKind code_kind,
@@ -32,6 +33,14 @@ class TieringManager {
 
   void NotifyICChanged() { any_ic_changed_ = true; }
 
+  // Called after optimized code of {function} deoptimized eagerly, with
+  // {frame} being the frame that execution continues in. Once {function} is
+  // in a deoptimization loop (see --deopt-loop-threshold), this makes the
+  // feedback of the operation that failed generic, so that the next
+  // optimization doesn't speculate on it again.
+  void OnEagerDeopt(JSFunction function, JavaScriptFrame* frame,
+                    DeoptimizeReason reason);
+
   // After this request, the next JumpLoop will perform OSR.
   void RequestOsrAtNextOpportunity(JSFunction function);
 
@@ -40,6 +49,10 @@ class TieringManager {
   // For use when no JSFunction is available.
   static int InitialInterruptBudget();
 
+  // Whether TurboFan should compile {function} with its cheaper pipeline
+  // because it's only lukewarm (see --turbo-adaptive-optimization-level).
+  static bool UseReducedTurbofanPipeline(JSFunction function, bool is_osr);
+
  private:
   // Make the decision whether to optimize the given function, and mark it for
   // optimization if the decision was 'yes'.
@@ -0,0 +1,121 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The first line of a profile file, to reject files in an unknown format.
+constexpr char kProfileHeader[] = "v8-tiering-profile-v1";
+
+// A 32-bit FNV-1a hash of the source's UTF-16 code units. Unlike the string
+// hash of the heap, this doesn't depend on the isolate's hash seed and covers
+// the whole source, so it identifies the same script in different processes.
+uint32_t HashSource(String source) {
+  const int length = source.length();
+  std::unique_ptr<uint16_t[]> buffer(new uint16_t[length]);
+  String::WriteToFlat(source, buffer.get(), 0, length);
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < length; i++) {
+    hash = (hash ^ buffer[i]) * 16777619u;
+  }
+  return hash;
+}
+
+}  // namespace
+
+void TieringProfile::Load(const char* filename) {
+  std::ifstream stream(filename);
+  if (!stream.is_open()) return;
+  if (!Load(stream)) {
+    PrintF("Ignoring tiering profile '%s' with an unknown format\n",
+           filename);
+  }
+}
+
+bool TieringProfile::Load(std::istream& stream) {
+  std::string header;
+  if (!std::getline(stream, header) || header != kProfileHeader) return false;
+  uint32_t script_hash;
+  int start_position;
+  while (stream >> script_hash >> start_position) {
+    hot_functions_.insert(KeyFor(script_hash, start_position));
+  }
+  return true;
+}
+
+uint32_t TieringProfile::ScriptHash(Script script) {
+  auto it = script_hashes_.find(script.id());
+  if (it != script_hashes_.end()) return it->second;
+  uint32_t hash = HashSource(String::cast(script.source()));
+  script_hashes_[script.id()] = hash;
+  return hash;
+}
+
+bool TieringProfile::GetKey(SharedFunctionInfo shared, Key* key) {
+  if (!shared.script().IsScript()) return false;
+  Script script = Script::cast(shared.script());
+  if (!script.source().IsString()) return false;
+  *key = KeyFor(ScriptHash(script), shared.StartPosition());
+  return true;
+}
+
+void TieringProfile::Apply(FeedbackVector vector) {
+  if (hot_functions_.empty()) return;
+  DisallowGarbageCollection no_gc;
+  SharedFunctionInfo shared = vector.shared_function_info();
+  if (shared.has_optimization_hint()) return;
+  Key key;
+  if (!GetKey(shared, &key) || hot_functions_.count(key) == 0) return;
+  shared.set_has_optimization_hint(true);
+}
+
+void TieringProfile::RecordOptimized(SharedFunctionInfo shared) {
+  DisallowGarbageCollection no_gc;
+  Key key;
+  if (!GetKey(shared, &key)) return;
+  optimized_functions_.insert(key);
+}
+
+void TieringProfile::Write(const char* filename) {
+  std::ofstream stream(filename);
+  if (!stream.is_open()) {
+    PrintF("Failed to write tiering profile '%s'\n", filename);
+    return;
+  }
+  Write(stream);
+}
+
+void TieringProfile::Write(std::ostream& stream) {
+  stream << kProfileHeader << "\n";
+  for (Key key : optimized_functions_) {
+    stream << static_cast<uint32_t>(key >> 32) << " "
+           << static_cast<int>(static_cast<uint32_t>(key)) << "\n";
+  }
+}
+
+std::string TieringProfile::OutputFileName() const {
+  DCHECK_NOT_NULL(FLAG_tiering_profile_output);
+  std::string filename(FLAG_tiering_profile_output);
+  if (isolate_->id() != 0) filename += "." + std::to_string(isolate_->id());
+  return filename;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,81 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_TIERING_PROFILE_H_
+#define V8_EXECUTION_TIERING_PROFILE_H_
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace v8 {
+namespace internal {
+
+class FeedbackVector;
+class Isolate;
+class Script;
+class SharedFunctionInfo;
+
+// A profile of the functions that were optimized by TurboFan in a previous
+// run, used to tier them up early in later runs.
+//
+// Functions are identified by a hash of their script's source and their start
+// position in it, so that the profile stays valid across processes as long as
+// the script doesn't change. The profile is read from --tiering-profile-input
+// when the isolate is set up, and applied to each function when its feedback
+// vector is allocated by setting the function's optimization hint. Functions
+// are recorded as TurboFan finalizes them, and written to
+// --tiering-profile-output when the isolate is torn down (see OutputFileName).
+//
+// Only the tiering decision is carried over. Type feedback itself refers to
+// maps and other heap objects of the previous process, and is collected anew.
+class TieringProfile final {
+ public:
+  explicit TieringProfile(Isolate* isolate) : isolate_(isolate) {}
+
+  // Reads the profile from {filename}. A missing file is treated as an empty
+  // profile, e.g. for the first run.
+  void Load(const char* filename);
+  // Returns false if {stream} doesn't hold a profile.
+  bool Load(std::istream& stream);
+
+  // Sets the optimization hint on the function of {vector} if it is part of
+  // the profile.
+  void Apply(FeedbackVector vector);
+
+  // Records that TurboFan optimized {shared}.
+  void RecordOptimized(SharedFunctionInfo shared);
+
+  // Writes the recorded functions to {filename}.
+  void Write(const char* filename);
+  void Write(std::ostream& stream);
+
+  // The file the isolate writes its profile to on teardown. The first isolate
+  // of the process writes to --tiering-profile-output, later ones append their
+  // isolate id, so that isolates don't overwrite each other's profiles.
+  std::string OutputFileName() const;
+
+ private:
+  using Key = uint64_t;
+
+  static Key KeyFor(uint32_t script_hash, int start_position) {
+    return (uint64_t{script_hash} << 32) |
+           static_cast<uint32_t>(start_position);
+  }
+  bool GetKey(SharedFunctionInfo shared, Key* key);
+  uint32_t ScriptHash(Script script);
+
+  Isolate* const isolate_;
+  std::unordered_set<Key> hot_functions_;
+  std::unordered_set<Key> optimized_functions_;
+  // Source hashes of the scripts seen so far, by script id.
+  std::unordered_map<int, uint32_t> script_hashes_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_TIERING_PROFILE_H_
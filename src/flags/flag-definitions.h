@@ -513,6 +513,14 @@ DEFINE_BOOL(future, FUTURE_BOOL,
 DEFINE_BOOL(maglev, false, "enable the maglev optimizing compiler")
 DEFINE_BOOL(maglev_inlining, false,
             "enable inlining in the maglev optimizing compiler")
+DEFINE_INT(max_maglev_inlined_bytecode_size, 100,
+           "maximum size of bytecode for a single inlining in maglev")
+DEFINE_INT(max_maglev_inline_depth, 2,
+           "maximum depth of nested inlining in maglev")
+DEFINE_FLOAT(min_maglev_inlining_frequency, 0.15,
+             "minimum call frequency for inlining in maglev")
+DEFINE_BOOL(maglev_untagged_phis, false,
+            "enable phi untagging in the maglev optimizing compiler")
 #else
 #define V8_ENABLE_MAGLEV_BOOL false
 DEFINE_BOOL_READONLY(maglev, false, "enable the maglev optimizing compiler")
@@ -628,6 +636,15 @@ DEFINE_INT(interrupt_budget_factor_for_feedback_allocation, 8,
            "The interrupt budget factor (applied to bytecode size) for "
            "allocating feedback vectors, used when bytecode size is known")
 
+// Tiering: profile-guided tier-up.
+DEFINE_STRING(tiering_profile_input, nullptr,
+              "read the functions optimized by TurboFan in a previous run from "
+              "this file, and optimize them early")
+DEFINE_STRING(tiering_profile_output, nullptr,
+              "write the functions optimized by TurboFan to this file when the "
+              "isolate is torn down (suffixed with the isolate id for all but "
+              "the first isolate)")
+
 // Tiering: Maglev.
 // The Maglev interrupt budget is chosen to be roughly 1/10th of Turbofan's
 // overall budget (including the multiple required ticks).
@@ -646,6 +663,10 @@ DEFINE_INT(bytecode_size_allowance_per_tick, 1100,
 DEFINE_INT(
     max_bytecode_size_for_early_opt, 81,
     "Maximum bytecode length for a function to be optimized on the first tick")
+DEFINE_INT(deopt_loop_threshold, 5,
+           "number of eager deopts in a row at the same site after which a "
+           "function is considered to be in a deoptimization loop and stops "
+           "being speculated on at that site (0 means never)")
 
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
@@ -765,6 +786,9 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_BOOL(concurrent_recompilation_largest_first, false,
+            "start compiling the largest queued function first, so that large "
+            "compilations overlap with smaller ones on other threads")
 DEFINE_BOOL(
     stress_concurrent_inlining, false,
     "create additional concurrent optimization jobs but throw away result")
@@ -868,6 +892,12 @@ DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "the compiler to hit (release) assertions")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
+DEFINE_BOOL(megamorphic_inlining, false,
+            "profile the targets of megamorphic calls and inline the most "
+            "frequent ones")
+DEFINE_FLOAT(min_megamorphic_inlining_share, 0.3,
+             "minimum share of the calls at a megamorphic call site that a "
+             "target needs to get inlined")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
 DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size, 999999)
@@ -904,17 +934,29 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
+DEFINE_BOOL(turbo_loop_unrolling, false,
+            "TurboFan unrolling of small loops over typed arrays")
+DEFINE_BOOL(turbo_loop_invariant_code_motion, false,
+            "TurboFan hoisting of loop-invariant checks and loads")
+DEFINE_BOOL(turbo_bounds_check_elimination, false,
+            "TurboFan bounds check elimination for loops")
+DEFINE_BOOL(trace_turbo_bce, false, "trace TurboFan bounds check elimination")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
+DEFINE_BOOL(turbo_allocation_folding_across_merges, true,
+            "TurboFan allocation folding across control-flow merges")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
                    turbo_instruction_scheduling)
+DEFINE_INT(turbo_instruction_scheduling_window, 64,
+           "maximum number of instructions that the instruction scheduler "
+           "reorders at once (0 means whole basic blocks)")
 DEFINE_BOOL(turbo_store_elimination, true,
             "enable store-store elimination in TurboFan")
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
@@ -932,6 +974,14 @@ DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, true,
             "fall back to the mid-tier register allocator for huge functions")
 DEFINE_BOOL(turbo_force_mid_tier_regalloc, false,
             "always use the mid-tier register allocator (for testing)")
+DEFINE_BOOL(turbo_adaptive_optimization_level, false,
+            "compile lukewarm functions with a cheaper TurboFan pipeline, "
+            "without loop peeling and escape analysis and with the mid-tier "
+            "register allocator")
+DEFINE_INT(turbo_full_optimization_invocation_count, 1000,
+           "invocation count from which functions are compiled with the full "
+           "TurboFan pipeline, and code compiled with the cheaper one is "
+           "recompiled (with --turbo-adaptive-optimization-level)")
 
 DEFINE_BOOL(turbo_optimize_apply, true, "optimize Function.prototype.apply")
 
@@ -1351,6 +1401,10 @@ DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
 DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
+DEFINE_BOOL(aggressive_code_space_compaction, false,
+            "Use memory reducing compaction heuristics for code space on all "
+            "full collections to keep code pages dense (requires "
+            "--compact-code-space).")
 DEFINE_BOOL(compact_maps, false,
             "Perform compaction on maps on full collections.")
 DEFINE_BOOL(use_map_space, true, "Use separate space for maps.")
@@ -1498,6 +1552,9 @@ DEFINE_BOOL(stress_background_compile, false,
             "stress test parsing on background")
 DEFINE_BOOL(concurrent_cache_deserialization, true,
             "enable deserializing code caches on background")
+DEFINE_BOOL(code_cache_optimization_hints, false,
+            "record which functions were optimized by TurboFan in the code "
+            "cache, and optimize them early after deserializing it")
 DEFINE_BOOL(disable_old_api_accessors, false,
             "Disable old-style API accessors whose setters trigger through the "
             "prototype chain")
@@ -1570,6 +1627,8 @@ DEFINE_BOOL(trace_deopt, false, "trace deoptimization")
 DEFINE_BOOL(log_deopt, false, "log deoptimization")
 DEFINE_BOOL(trace_deopt_verbose, false, "extra verbose deoptimization tracing")
 DEFINE_IMPLICATION(trace_deopt_verbose, trace_deopt)
+DEFINE_BOOL(trace_deopt_loops, false,
+            "trace functions in deoptimization loops")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(always_opt, false, "always try to optimize functions")
@@ -563,6 +563,11 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
 
     local_marking_worklists.Publish();
     local_weak_objects.Publish();
+    if (cpp_heap) {
+      // Hand off wrappers discovered by this task to the C++ concurrent markers
+      // right away instead of leaving them until the next incremental step.
+      cpp_heap->NotifyConcurrentMarkingOfWorkIfNeeded();
+    }
     base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes, 0);
     total_marked_bytes_ += marked_bytes;
 
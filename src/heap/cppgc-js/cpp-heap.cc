@@ -902,6 +902,13 @@ CppHeap::CreateCppMarkingStateForMutatorThread() {
       static_cast<UnifiedHeapMarker*>(marker())->GetMutatorMarkingState());
 }
 
+void CppHeap::NotifyConcurrentMarkingOfWorkIfNeeded() {
+  // V8's concurrent markers are paused whenever the C++ concurrent marking job
+  // is cancelled or restarted, so the job handle is stable here.
+  DCHECK(IsMarking());
+  marker()->NotifyConcurrentMarkingOfWorkIfNeeded();
+}
+
 CppHeap::PauseConcurrentMarkingScope::PauseConcurrentMarkingScope(
     CppHeap* cpp_heap) {
   if (cpp_heap && cpp_heap->marker()) {
@@ -164,6 +164,11 @@ class V8_EXPORT_PRIVATE CppHeap final
   std::unique_ptr<CppMarkingState> CreateCppMarkingState();
   std::unique_ptr<CppMarkingState> CreateCppMarkingStateForMutatorThread();
 
+  // Called by V8's concurrent markers after they published wrappers to the
+  // C++ worklists. Wakes up C++ concurrent markers that may have run out of
+  // work in the meantime instead of waiting for the next incremental step.
+  void NotifyConcurrentMarkingOfWorkIfNeeded();
+
  private:
   void FinalizeIncrementalGarbageCollectionIfNeeded(
       cppgc::Heap::StackState) final {
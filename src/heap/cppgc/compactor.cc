@@ -4,6 +4,7 @@
 
 #include "src/heap/cppgc/compactor.h"
 
+#include <algorithm>
 #include <map>
 #include <numeric>
 #include <unordered_map>
@@ -28,6 +29,16 @@ namespace {
 // should be considered.
 static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
 
+// Default amount of page memory that is compacted in a single garbage
+// collection cycle. Limits the time spent compacting in the atomic pause for
+// heaps with many or large compactable spaces.
+static constexpr size_t kDefaultCompactionBudgetPerCycle = 4 * kMB;
+
+bool IsBeingCompacted(const BasePage* page) {
+  return !page->is_large() &&
+         NormalPageSpace::From(page->space()).is_being_compacted();
+}
+
 // The real worker behind heap compaction, recording references to movable
 // objects ("slots".) When the objects end up being compacted and moved,
 // relocate() will adjust the slots to point to the new location of the
@@ -103,7 +114,8 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   // The following cases are not compacted and do not require recording:
   // - Compactable object on large pages.
   // - Compactable object on non-compactable spaces.
-  if (value_page->is_large() || !value_page->space().is_compactable()) return;
+  // - Compactable object on spaces that are not compacted in this cycle.
+  if (!IsBeingCompacted(value_page)) return;
 
   // Slots must reside in and values must point to live objects at this
   // point. |value| usually points to a separate object but can also point
@@ -124,7 +136,7 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   movable_references_.emplace(value, slot);
 
   // Check whether the slot itself resides on a page that is compacted.
-  if (V8_LIKELY(!slot_page->space().is_compactable())) return;
+  if (V8_LIKELY(!IsBeingCompacted(slot_page))) return;
 
   CHECK_EQ(interior_movable_references_.end(),
            interior_movable_references_.find(slot));
@@ -435,7 +447,9 @@ size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
 
 }  // namespace
 
-Compactor::Compactor(RawHeap& heap) : heap_(heap) {
+Compactor::Compactor(RawHeap& heap)
+    : heap_(heap),
+      compaction_budget_per_cycle_(kDefaultCompactionBudgetPerCycle) {
   for (auto& space : heap_) {
     if (!space->is_compactable()) continue;
     DCHECK_EQ(&heap, space->raw_heap());
@@ -488,7 +502,37 @@ bool Compactor::CancelIfShouldNotCompact(
   return true;
 }
 
+void Compactor::SelectSpacesForCompaction() {
+  DCHECK(spaces_to_compact_.empty());
+  for (NormalPageSpace* space : compactable_spaces_) {
+    if (space->size()) spaces_to_compact_.push_back(space);
+  }
+  // Prefer the most fragmented spaces. Spaces that are left out due to the
+  // budget still have their free lists intact and are thus picked up by
+  // subsequent cycles, spreading compaction of the heap over multiple cycles.
+  std::stable_sort(spaces_to_compact_.begin(), spaces_to_compact_.end(),
+                   [](const NormalPageSpace* lhs, const NormalPageSpace* rhs) {
+                     return lhs->free_list().Size() > rhs->free_list().Size();
+                   });
+  size_t compacted_bytes = 0;
+  auto it = spaces_to_compact_.begin();
+  for (; it != spaces_to_compact_.end(); ++it) {
+    const size_t space_bytes = (*it)->size() * kPageSize;
+    // Always compact at least one space to guarantee progress.
+    if (compacted_bytes &&
+        compacted_bytes + space_bytes > compaction_budget_per_cycle_) {
+      break;
+    }
+    compacted_bytes += space_bytes;
+    (*it)->set_is_being_compacted(true);
+  }
+  spaces_to_compact_.erase(it, spaces_to_compact_.end());
+}
+
 Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
+  for (NormalPageSpace* space : compactable_spaces_) {
+    space->set_is_being_compacted(false);
+  }
   if (is_cancelled_ && compaction_worklists_) {
     compaction_worklists_->movable_slots_worklist()->Clear();
     compaction_worklists_.reset();
@@ -498,6 +542,8 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   StatsCollector::EnabledScope stats_scope(heap_.heap()->stats_collector(),
                                            StatsCollector::kAtomicCompact);
 
+  SelectSpacesForCompaction();
+
   MovableReferences movable_references(*heap_.heap());
 
   CompactionWorklists::MovableReferencesWorklist::Local local(
@@ -508,9 +554,10 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   }
   compaction_worklists_.reset();
 
-  for (NormalPageSpace* space : compactable_spaces_) {
+  for (NormalPageSpace* space : spaces_to_compact_) {
     CompactSpace(space, movable_references);
   }
+  spaces_to_compact_.clear();
 
   enable_for_next_gc_for_testing_ = false;
   is_enabled_ = false;
@@ -37,16 +37,31 @@ class V8_EXPORT_PRIVATE Compactor final {
   void EnableForNextGCForTesting();
   bool IsEnabledForTesting() const { return is_enabled_; }
 
+  // Limits the amount of page memory that is compacted in a single garbage
+  // collection cycle. Spaces that do not fit into the budget are swept
+  // regularly and are considered again in subsequent cycles.
+  void SetCompactionBudgetPerCycle(size_t budget) {
+    compaction_budget_per_cycle_ = budget;
+  }
+  size_t compaction_budget_per_cycle() const {
+    return compaction_budget_per_cycle_;
+  }
+
  private:
   bool ShouldCompact(GarbageCollector::Config::MarkingType,
                      GarbageCollector::Config::StackState) const;
+  void SelectSpacesForCompaction();
 
   RawHeap& heap_;
   // Compactor does not own the compactable spaces. The heap owns all spaces.
   std::vector<NormalPageSpace*> compactable_spaces_;
+  // Subset of |compactable_spaces_| that is compacted in the current cycle.
+  std::vector<NormalPageSpace*> spaces_to_compact_;
 
   std::unique_ptr<CompactionWorklists> compaction_worklists_;
 
+  size_t compaction_budget_per_cycle_;
+
   bool is_enabled_ = false;
   bool is_cancelled_ = false;
   bool enable_for_next_gc_for_testing_ = false;
@@ -238,6 +238,13 @@ void ConcurrentMarkerBase::NotifyIncrementalMutatorStepCompleted() {
   }
 }
 
+void ConcurrentMarkerBase::NotifyOfWorkIfNeeded() {
+  if (!IsActive()) return;
+  if (HasWorkForConcurrentMarking(marking_worklists_)) {
+    concurrent_marking_handle_->NotifyConcurrencyIncrease();
+  }
+}
+
 void ConcurrentMarkerBase::IncreaseMarkingPriorityIfNeeded() {
   if (!concurrent_marking_handle_->UpdatePriorityEnabled()) return;
   if (concurrent_marking_priority_increased_) return;
@@ -30,6 +30,11 @@ class V8_EXPORT_PRIVATE ConcurrentMarkerBase {
   bool Cancel();
 
   void NotifyIncrementalMutatorStepCompleted();
+  // Notifies the job of work that was published to the global worklists
+  // outside of the job, e.g., by V8's concurrent markers tracing wrappers.
+  // Safe to call from any thread as long as the job is not concurrently
+  // cancelled or restarted.
+  void NotifyOfWorkIfNeeded();
 
   bool IsActive() const;
 
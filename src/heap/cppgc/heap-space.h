@@ -108,9 +108,18 @@ class V8_EXPORT_PRIVATE NormalPageSpace final : public BaseSpace {
   FreeList& free_list() { return free_list_; }
   const FreeList& free_list() const { return free_list_; }
 
+  // Set by the compactor for compactable spaces that have been selected for
+  // compaction in the current garbage collection cycle.
+  bool is_being_compacted() const { return is_being_compacted_; }
+  void set_is_being_compacted(bool value) {
+    DCHECK_IMPLIES(value, is_compactable());
+    is_being_compacted_ = value;
+  }
+
  private:
   LinearAllocationBuffer current_lab_;
   FreeList free_list_;
+  bool is_being_compacted_ = false;
 };
 
 class V8_EXPORT_PRIVATE LargePageSpace final : public BaseSpace {
@@ -640,6 +640,11 @@ void MarkerBase::WaitForConcurrentMarkingForTesting() {
   concurrent_marker_->Join();
 }
 
+void MarkerBase::NotifyConcurrentMarkingOfWorkIfNeeded() {
+  if (!concurrent_marker_) return;
+  concurrent_marker_->NotifyOfWorkIfNeeded();
+}
+
 MarkerBase::PauseConcurrentMarkingScope::PauseConcurrentMarkingScope(
     MarkerBase& marker)
     : marker_(marker), resume_on_exit_(marker_.concurrent_marker_->Cancel()) {}
@@ -112,6 +112,7 @@ class V8_EXPORT_PRIVATE MarkerBase {
   void ProcessWeakness();
 
   bool JoinConcurrentMarkingIfNeeded();
+  void NotifyConcurrentMarkingOfWorkIfNeeded();
 
   inline void WriteBarrierForInConstructionObject(HeapObjectHeader&);
 
@@ -697,7 +697,7 @@ class PrepareForSweepVisitor final
  protected:
   bool VisitNormalPageSpace(NormalPageSpace& space) {
     if ((compactable_space_handling_ == CompactableSpaceHandling::kIgnore) &&
-        space.is_compactable())
+        space.is_being_compacted())
       return true;
     DCHECK(!space.linear_allocation_buffer().size());
     space.free_list().Clear();
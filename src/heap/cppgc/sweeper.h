@@ -26,6 +26,7 @@ class V8_EXPORT_PRIVATE Sweeper final {
  public:
   struct SweepingConfig {
     using SweepingType = cppgc::Heap::SweepingType;
+    // kIgnore skips spaces that have been compacted in the current cycle.
     enum class CompactableSpaceHandling { kSweep, kIgnore };
     enum class FreeMemoryHandling { kDoNotDiscard, kDiscardWherePossible };
 
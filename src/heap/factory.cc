@@ -509,9 +509,12 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector.set_length(length);
   vector.set_invocation_count(0);
   vector.set_profiler_ticks(0);
-  vector.set_placeholder0(0);
+  vector.set_last_deopt_bytecode_offset(
+      FeedbackVector::kNoDeoptBytecodeOffset);
+  vector.set_deopt_count(0);
   vector.reset_osr_state();
   vector.reset_flags();
+  vector.clear_padding();
   vector.set_closure_feedback_cell_array(*closure_feedback_cell_array);
 
   // TODO(leszeks): Initialize based on the feedback metadata.
@@ -793,6 +793,16 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   }
 }
 
+static void ComputeCodeSpaceEvacuationHeuristics(
+    int* target_fragmentation_percent, size_t* max_evacuated_bytes) {
+  const int kTargetFragmentationPercentForCodeSpace = 20;
+  const size_t kMaxEvacuatedBytesForCodeSpace = 12 * MB;
+  *target_fragmentation_percent = std::min(
+      *target_fragmentation_percent, kTargetFragmentationPercentForCodeSpace);
+  *max_evacuated_bytes =
+      std::max(*max_evacuated_bytes, kMaxEvacuatedBytesForCodeSpace);
+}
+
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   DCHECK(space->identity() == OLD_SPACE || space->identity() == CODE_SPACE ||
          space->identity() == MAP_SPACE);
@@ -818,6 +828,15 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     //   compacted.
     ComputeEvacuationHeuristics(area_size, &target_fragmentation_percent,
                                 &max_evacuated_bytes);
+    if (space->identity() == CODE_SPACE &&
+        FLAG_aggressive_code_space_compaction) {
+      // Code that is repeatedly deoptimized and reoptimized leaves many
+      // sparsely populated code pages behind in long-running processes. Those
+      // hurt instruction cache and TLB locality, so they are compacted as if
+      // the heap was reducing memory.
+      ComputeCodeSpaceEvacuationHeuristics(&target_fragmentation_percent,
+                                           &max_evacuated_bytes);
+    }
     free_bytes_threshold = target_fragmentation_percent * (area_size / 100);
   }
 
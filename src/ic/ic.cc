@@ -3291,6 +3291,17 @@ RUNTIME_FUNCTION(Runtime_CloneObjectIC_Miss) {
                            CloneObjectSlowPath(isolate, source, flags));
 }
 
+RUNTIME_FUNCTION(Runtime_TransitionCallICToMegamorphic) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  Handle<FeedbackVector> vector = args.at<FeedbackVector>(0);
+  int index = args.tagged_index_value_at(1);
+  Handle<Object> target = args.at(2);
+  FeedbackNexus nexus(vector, FeedbackVector::ToSlot(index));
+  nexus.ConfigureMegamorphicCall(target);
+  return ReadOnlyRoots(isolate).undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_StoreCallbackProperty) {
   Handle<JSObject> receiver = args.at<JSObject>(0);
   Handle<JSObject> holder = args.at<JSObject>(1);
@@ -99,6 +99,8 @@ namespace internal {
   HR(wasm_catch_count, V8.WasmCatchCount, 0, 100000, 30)                       \
   /* Ticks observed in a single Turbofan compilation, in 1K */                 \
   HR(turbofan_ticks, V8.TurboFan1KTicks, 0, 100000, 200)                       \
+  /* Maglev jobs finalized per install interrupt */                            \
+  HR(maglev_finalize_batch_size, V8.MaglevFinalizeBatchSize, 1, 1000, 51)      \
   /* Backtracks observed in a single regexp interpreter execution */           \
   /* The maximum of 100M backtracks takes roughly 2 seconds on my machine. */  \
   HR(regexp_backtracks, V8.RegExpBacktracks, 1, 100000000, 50)                 \
@@ -200,6 +202,14 @@ namespace internal {
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_total_time,                                                  \
      V8.TurboFanOptimizeForOnStackReplacementTotalTime, 10000000, MICROSECOND) \
+  /* Maglev timers. */                                                         \
+  HT(maglev_optimize_queue_latency, V8.MaglevOptimizeQueueLatency, 10000000,   \
+     MICROSECOND)                                                              \
+  HT(maglev_optimize_execute, V8.MaglevOptimizeExecute, 1000000, MICROSECOND)  \
+  HT(maglev_optimize_finalize, V8.MaglevOptimizeFinalize, 1000000,             \
+     MICROSECOND)                                                              \
+  HT(maglev_optimize_install_latency, V8.MaglevOptimizeInstallLatency,         \
+     10000000, MICROSECOND)                                                    \
   /* Wasm timers. */                                                           \
   HT(wasm_compile_asm_module_time, V8.WasmCompileModuleMicroSeconds.asm,       \
      10000000, MICROSECOND)                                                    \
@@ -333,6 +343,8 @@ namespace internal {
   SC(sub_string_runtime, V8.SubStringRuntime)                                  \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
+  /* Number of functions that got into a deoptimization loop. */               \
+  SC(deopt_loops, V8.DeoptLoops)                                               \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
   SC(new_space_bytes_used, V8.MemoryNewSpaceBytesUsed)                         \
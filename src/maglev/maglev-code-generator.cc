@@ -427,15 +427,21 @@ class MaglevCodeGeneratorImpl final {
 
   void EmitLazyDeopt(LazyDeoptInfo* deopt_info) {
     const MaglevCompilationUnit& unit = deopt_info->unit;
-    DCHECK_NULL(unit.caller());
-    DCHECK_EQ(unit.inlining_depth(), 0);
 
-    int frame_count = 1;
-    int jsframe_count = 1;
+    int frame_count = 1 + unit.inlining_depth();
+    int jsframe_count = frame_count;
     int update_feedback_count = 0;
     deopt_info->deopt_index = translation_array_builder_.BeginTranslation(
         frame_count, jsframe_count, update_feedback_count);
 
+    // The caller frames of an inlined function resume after the inlined call,
+    // and don't have a result to write.
+    const InputLocation* input_locations = deopt_info->input_locations;
+    if (deopt_info->state.parent) {
+      input_locations = EmitDeoptFrame(*unit.caller(), *deopt_info->state.parent,
+                                       input_locations);
+    }
+
     // Return offsets are counted from the end of the translation frame, which
     // is the array [parameters..., locals..., accumulator].
     int return_offset;
@@ -465,8 +471,7 @@ class MaglevCodeGeneratorImpl final {
         unit.register_count(), return_offset, return_count);
 
     EmitDeoptFrameValues(unit, deopt_info->state.register_frame,
-                         deopt_info->input_locations,
-                         deopt_info->result_location);
+                         input_locations, deopt_info->result_location);
   }
 
   void EmitDeoptStoreRegister(const compiler::AllocatedOperand& operand,
@@ -550,19 +555,24 @@ class MaglevCodeGeneratorImpl final {
             DCHECK_EQ(reg.ToParameterIndex(), i);
             if (reg != result_location) {
               EmitDeoptFrameSingleValue(value, *input_location);
+              input_location++;
             } else {
               translation_array_builder_.StoreLiteral(
                   kOptimizedOutConstantIndex);
             }
             i++;
-            input_location++;
           });
     }
 
     // Context
-    int context_index =
-        DeoptStackSlotIndexFromFPOffset(StandardFrameConstants::kContextOffset);
-    translation_array_builder_.StoreStackSlot(context_index);
+    if (compilation_unit.inlining_depth() == 0) {
+      int context_index = DeoptStackSlotIndexFromFPOffset(
+          StandardFrameConstants::kContextOffset);
+      translation_array_builder_.StoreStackSlot(context_index);
+    } else {
+      translation_array_builder_.StoreLiteral(
+          GetDeoptLiteral(*compilation_unit.function().context().object()));
+    }
 
     // Locals
     {
@@ -570,10 +580,7 @@ class MaglevCodeGeneratorImpl final {
       checkpoint_state->ForEachLocal(
           compilation_unit, [&](ValueNode* value, interpreter::Register reg) {
             DCHECK_LE(i, reg.index());
-            if (reg == result_location) {
-              input_location++;
-              return;
-            }
+            if (reg == result_location) return;
             while (i < reg.index()) {
               translation_array_builder_.StoreLiteral(
                   kOptimizedOutConstantIndex);
@@ -596,6 +603,7 @@ class MaglevCodeGeneratorImpl final {
           result_location != interpreter::Register::virtual_accumulator()) {
         ValueNode* value = checkpoint_state->accumulator(compilation_unit);
         EmitDeoptFrameSingleValue(value, *input_location);
+        input_location++;
       } else {
         translation_array_builder_.StoreLiteral(kOptimizedOutConstantIndex);
       }
@@ -35,6 +35,7 @@
 #include "src/maglev/maglev-graph.h"
 #include "src/maglev/maglev-interpreter-frame-state.h"
 #include "src/maglev/maglev-ir.h"
+#include "src/maglev/maglev-phi-representation-selector.h"
 #include "src/maglev/maglev-regalloc.h"
 #include "src/maglev/maglev-vreg-allocator.h"
 #include "src/objects/code-inl.h"
@@ -139,6 +140,12 @@ class UseMarkingProcessor {
     int use_id = node->id();
     int index = 0;
 
+    if (deopt_info->state.parent) {
+      MarkCheckpointNodes(node, *deopt_info->unit.caller(),
+                          deopt_info->state.parent, deopt_info->input_locations,
+                          state, index);
+    }
+
     register_frame->ForEachValue(
         deopt_info->unit, [&](ValueNode* node, interpreter::Register reg) {
           // Skip over the result location.
@@ -191,6 +198,12 @@ void MaglevCompiler::Compile(LocalIsolate* local_isolate,
   }
 #endif
 
+  if (FLAG_maglev_untagged_phis) {
+    GraphProcessor<MaglevPhiRepresentationSelector> representation_selector(
+        compilation_info);
+    representation_selector.ProcessGraph(graph_builder.graph());
+  }
+
   {
     GraphMultiProcessor<NumberingProcessor, UseMarkingProcessor,
                         MaglevVregAllocator>
@@ -10,9 +10,12 @@
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/heap-inl.h"
+#include "src/logging/counters.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-compiler.h"
 #include "src/maglev/maglev-graph-labeller.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/utils/identity-map.h"
 #include "src/utils/locked-queue-inl.h"
@@ -119,6 +122,38 @@ Handle<JSFunction> MaglevCompilationJob::function() const {
   return info_->toplevel_compilation_unit()->function().object();
 }
 
+void MaglevCompilationJob::RecordCompilationStats(Isolate* isolate) const {
+  Counters* const counters = isolate->counters();
+  counters->maglev_optimize_execute()->AddTimedSample(time_taken_to_execute_);
+  counters->maglev_optimize_finalize()->AddTimedSample(
+      time_taken_to_finalize_);
+}
+
+void MaglevConcurrentDispatcher::IncomingQueue::Enqueue(
+    std::unique_ptr<MaglevCompilationJob>&& job, int priority) {
+  base::MutexGuard guard(&mutex_);
+  queue_.push({priority, next_sequence_number_++, std::move(job)});
+}
+
+bool MaglevConcurrentDispatcher::IncomingQueue::Dequeue(
+    std::unique_ptr<MaglevCompilationJob>* job) {
+  base::MutexGuard guard(&mutex_);
+  if (queue_.empty()) return false;
+  *job = std::move(queue_.top().job);
+  queue_.pop();
+  return true;
+}
+
+bool MaglevConcurrentDispatcher::IncomingQueue::IsEmpty() const {
+  base::MutexGuard guard(&mutex_);
+  return queue_.empty();
+}
+
+size_t MaglevConcurrentDispatcher::IncomingQueue::size() const {
+  base::MutexGuard guard(&mutex_);
+  return queue_.size();
+}
+
 // The JobTask is posted to V8::GetCurrentPlatform(). It's responsible for
 // processing the incoming queue on a worker thread.
 class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
@@ -130,16 +165,31 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
     LocalIsolate local_isolate(isolate(), ThreadKind::kBackground);
     DCHECK(local_isolate.heap()->IsParked());
 
+    bool has_finished_jobs = false;
     while (!incoming_queue()->IsEmpty() && !delegate->ShouldYield()) {
       std::unique_ptr<MaglevCompilationJob> job;
       if (!incoming_queue()->Dequeue(&job)) break;
       DCHECK_NOT_NULL(job);
+      counters()->maglev_optimize_queue_latency()->AddTimedSample(
+          base::TimeTicks::Now() - job->enqueue_time());
       RuntimeCallStats* rcs = nullptr;  // TODO(v8:7700): Implement.
       CompilationJob::Status status = job->ExecuteJob(rcs, &local_isolate);
       CHECK_EQ(status, CompilationJob::SUCCEEDED);
+      job->set_execute_end_time(base::TimeTicks::Now());
+      // The main thread finalizes all finished jobs per install interrupt, so
+      // only the first job of a batch needs to request one. The size check
+      // races with the main thread draining the queue, but the request below
+      // makes sure that no job is left behind.
+      bool is_first_of_batch = outgoing_queue()->IsEmpty();
       outgoing_queue()->Enqueue(std::move(job));
+      has_finished_jobs = true;
+      if (is_first_of_batch) {
+        isolate()->stack_guard()->RequestInstallMaglevCode();
+      }
+    }
+    if (has_finished_jobs) {
+      isolate()->stack_guard()->RequestInstallMaglevCode();
     }
-    isolate()->stack_guard()->RequestInstallMaglevCode();
   }
 
   size_t GetMaxConcurrency(size_t) const override {
@@ -148,7 +198,10 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
 
  private:
   Isolate* isolate() const { return dispatcher_->isolate_; }
-  QueueT* incoming_queue() const { return &dispatcher_->incoming_queue_; }
+  Counters* counters() const { return isolate()->counters(); }
+  IncomingQueue* incoming_queue() const {
+    return &dispatcher_->incoming_queue_;
+  }
   QueueT* outgoing_queue() const { return &dispatcher_->outgoing_queue_; }
 
   MaglevConcurrentDispatcher* const dispatcher_;
@@ -179,21 +232,36 @@ void MaglevConcurrentDispatcher::EnqueueJob(
   DCHECK(is_enabled());
   // TODO(v8:7700): RCS.
   // RCS_SCOPE(isolate_, RuntimeCallCounterId::kCompileMaglev);
-  incoming_queue_.Enqueue(std::move(job));
+  Handle<JSFunction> function = job->function();
+  int priority = function->has_feedback_vector()
+                     ? function->feedback_vector().invocation_count()
+                     : 0;
+  job->set_enqueue_time(base::TimeTicks::Now());
+  incoming_queue_.Enqueue(std::move(job), priority);
   job_handle_->NotifyConcurrencyIncrease();
 }
 
 void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
   HandleScope handle_scope(isolate_);
-  while (!outgoing_queue_.IsEmpty()) {
-    std::unique_ptr<MaglevCompilationJob> job;
-    outgoing_queue_.Dequeue(&job);
+  // See OptimizingCompileDispatcher::InstallOptimizedFunctions.
+  CodePageCollectionMemoryModificationScope batch_install(isolate_->heap());
+  Counters* const counters = isolate_->counters();
+  int batch_size = 0;
+  std::unique_ptr<MaglevCompilationJob> job;
+  while (outgoing_queue_.Dequeue(&job)) {
+    counters->maglev_optimize_install_latency()->AddTimedSample(
+        base::TimeTicks::Now() - job->execute_end_time());
     CompilationJob::Status status = job->FinalizeJob(isolate_);
     // TODO(v8:7700): Use the result and check if job succeed
     // when all the bytecodes are implemented.
     if (status == CompilationJob::SUCCEEDED) {
       Compiler::FinalizeMaglevCompilationJob(job.get(), isolate_);
+      job->RecordCompilationStats(isolate_);
     }
+    batch_size++;
+  }
+  if (batch_size > 0) {
+    counters->maglev_finalize_batch_size()->AddSample(batch_size);
   }
 }
 
@@ -8,9 +8,14 @@
 #ifdef V8_ENABLE_MAGLEV
 
 #include <memory>
+#include <queue>
+#include <vector>
 
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/codegen/compiler.h"  // For OptimizedCompilationJob.
 #include "src/utils/locked-queue.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
 namespace internal {
@@ -43,7 +48,8 @@ class ExportedMaglevCompilationInfo final {
 };
 
 // The job is a single actual compilation task.
-class MaglevCompilationJob final : public OptimizedCompilationJob {
+class V8_EXPORT_PRIVATE MaglevCompilationJob final
+    : public OptimizedCompilationJob {
  public:
   static std::unique_ptr<MaglevCompilationJob> New(Isolate* isolate,
                                                    Handle<JSFunction> function);
@@ -56,12 +62,23 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
 
   Handle<JSFunction> function() const;
 
+  // Timestamps of the job's trip through the concurrent dispatcher, used to
+  // record queueing and installation latencies.
+  base::TimeTicks enqueue_time() const { return enqueue_time_; }
+  void set_enqueue_time(base::TimeTicks time) { enqueue_time_ = time; }
+  base::TimeTicks execute_end_time() const { return execute_end_time_; }
+  void set_execute_end_time(base::TimeTicks time) { execute_end_time_ = time; }
+
+  void RecordCompilationStats(Isolate* isolate) const;
+
  private:
   explicit MaglevCompilationJob(std::unique_ptr<MaglevCompilationInfo>&& info);
 
   MaglevCompilationInfo* info() const { return info_.get(); }
 
   const std::unique_ptr<MaglevCompilationInfo> info_;
+  base::TimeTicks enqueue_time_;
+  base::TimeTicks execute_end_time_;
 };
 
 // The public API for Maglev concurrent compilation.
@@ -73,6 +90,35 @@ class MaglevConcurrentDispatcher final {
   // them for simplicity - consider replacing with lock-free data structures.
   using QueueT = LockedQueue<std::unique_ptr<MaglevCompilationJob>>;
 
+  // The incoming queue hands out the hottest function first, as measured by
+  // the invocation count of its feedback vector at enqueue time. Jobs of
+  // equal hotness are processed in FIFO order.
+  class V8_EXPORT_PRIVATE IncomingQueue final {
+   public:
+    void Enqueue(std::unique_ptr<MaglevCompilationJob>&& job, int priority);
+    bool Dequeue(std::unique_ptr<MaglevCompilationJob>* job);
+    bool IsEmpty() const;
+    size_t size() const;
+
+   private:
+    struct Entry {
+      int priority;
+      uint64_t sequence_number;
+      // Mutable so that the job can be moved out of the top of the
+      // std::priority_queue before popping it.
+      mutable std::unique_ptr<MaglevCompilationJob> job;
+
+      bool operator<(const Entry& other) const {
+        if (priority != other.priority) return priority < other.priority;
+        return sequence_number > other.sequence_number;
+      }
+    };
+
+    mutable base::Mutex mutex_;
+    std::priority_queue<Entry, std::vector<Entry>> queue_;
+    uint64_t next_sequence_number_ = 0;
+  };
+
  public:
   explicit MaglevConcurrentDispatcher(Isolate* isolate);
   ~MaglevConcurrentDispatcher();
@@ -80,7 +126,8 @@ class MaglevConcurrentDispatcher final {
   // Called from the main thread.
   void EnqueueJob(std::unique_ptr<MaglevCompilationJob>&& job);
 
-  // Called from the main thread.
+  // Called from the main thread. Finalizes all jobs that finished compiling
+  // in one batch, so that a single install interrupt covers all of them.
   void FinalizeFinishedJobs();
 
   bool is_enabled() const { return static_cast<bool>(job_handle_); }
@@ -88,8 +135,10 @@ class MaglevConcurrentDispatcher final {
  private:
   Isolate* const isolate_;
   std::unique_ptr<JobHandle> job_handle_;
-  QueueT incoming_queue_;
+  IncomingQueue incoming_queue_;
   QueueT outgoing_queue_;
+
+  FRIEND_TEST(MaglevConcurrentDispatcherTest, IncomingQueueOrder);
 };
 
 }  // namespace maglev
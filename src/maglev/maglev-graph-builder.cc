@@ -34,6 +34,59 @@ int LoadSimpleFieldHandler(FieldIndex field_index) {
   return config;
 }
 
+// Whether the field access handler {handler} can be lowered to a LoadField.
+bool IsInlineableLoadFieldHandler(int handler) {
+  return LoadHandler::KindBits::decode(handler) == LoadHandler::Kind::kField &&
+         !LoadHandler::IsWasmStructBits::decode(handler) &&
+         !LoadHandler::IsDoubleBits::decode(handler);
+}
+
+// Whether the field access handler {handler} can be lowered to a StoreField.
+bool IsInlineableStoreFieldHandler(int handler) {
+  if (StoreHandler::KindBits::decode(handler) != StoreHandler::Kind::kField) {
+    return false;
+  }
+  if (!StoreHandler::IsInobjectBits::decode(handler)) return false;
+  switch (StoreHandler::RepresentationBits::decode(handler)) {
+    case Representation::kSmi:
+    case Representation::kTagged:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsSupportedJSArrayElementsKind(ElementsKind kind) {
+  switch (kind) {
+    case PACKED_SMI_ELEMENTS:
+    case PACKED_ELEMENTS:
+    case PACKED_DOUBLE_ELEMENTS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsSupportedTypedArrayElementsKind(ElementsKind kind,
+                                       compiler::AccessMode mode) {
+  switch (kind) {
+    case INT8_ELEMENTS:
+    case UINT8_ELEMENTS:
+    case INT16_ELEMENTS:
+    case UINT16_ELEMENTS:
+    case INT32_ELEMENTS:
+      return true;
+    case UINT8_CLAMPED_ELEMENTS:
+      // Loads are the same as for UINT8_ELEMENTS, but stores need clamping.
+      return mode == compiler::AccessMode::kLoad;
+    case UINT32_ELEMENTS:
+      // Stores truncate the int32 value, but loads may not fit in an int32.
+      return mode == compiler::AccessMode::kStore;
+    default:
+      return false;
+  }
+}
+
 }  // namespace
 
 MaglevGraphBuilder::MaglevGraphBuilder(LocalIsolate* local_isolate,
@@ -102,15 +155,23 @@ void MaglevGraphBuilder::SetArgument(int i, ValueNode* value) {
   current_interpreter_frame_.set(reg, value);
 }
 
-void MaglevGraphBuilder::BuildRegisterFrameInitialization() {
+void MaglevGraphBuilder::BuildRegisterFrameInitialization(ValueNode* context,
+                                                          ValueNode* closure) {
   // TODO(leszeks): Extract out a separate "incoming context/closure" nodes,
   // to be able to read in the machine register but also use the frame-spilled
   // slot.
-  interpreter::Register regs[] = {interpreter::Register::current_context(),
-                                  interpreter::Register::function_closure()};
-  for (interpreter::Register& reg : regs) {
-    current_interpreter_frame_.set(reg, AddNewNode<InitialValue>({}, reg));
+  if (context == nullptr) {
+    context = AddNewNode<InitialValue>(
+        {}, interpreter::Register::current_context());
   }
+  current_interpreter_frame_.set(interpreter::Register::current_context(),
+                                 context);
+  if (closure == nullptr) {
+    closure = AddNewNode<InitialValue>(
+        {}, interpreter::Register::function_closure());
+  }
+  current_interpreter_frame_.set(interpreter::Register::function_closure(),
+                                 closure);
 
   interpreter::Register new_target_or_generator_register =
       bytecode().incoming_new_target_or_generator_register();
@@ -145,9 +206,21 @@ void MaglevGraphBuilder::BuildRegisterFrameInitialization() {
     this_field_will_be_unused_once_all_bytecodes_are_supported_ = true; \
   } while (false)
 
-#define MAGLEV_UNIMPLEMENTED_BYTECODE(Name) \
+// Set for every bytecode declared with MAGLEV_UNIMPLEMENTED_BYTECODE, so that
+// we can check for them before inlining.
+template <interpreter::Bytecode bytecode>
+constexpr bool kIsUnimplementedBytecode = false;
+
+#define MAGLEV_UNIMPLEMENTED_BYTECODE(Name)                                 \
+  template <>                                                               \
+  constexpr bool kIsUnimplementedBytecode<interpreter::Bytecode::k##Name> = \
+      true;                                                                 \
   void MaglevGraphBuilder::Visit##Name() { MAGLEV_UNIMPLEMENTED(Name); }
 
+namespace {
+bool IsUnimplementedBytecode(interpreter::Bytecode bytecode);
+}  // namespace
+
 namespace {
 template <Operation kOperation>
 struct NodeForOperationHelper;
@@ -403,6 +476,174 @@ void MaglevGraphBuilder::BuildPropertyCellAccess(
           PropertyCell::kValueOffset, FieldIndex::kTagged))));
 }
 
+bool MaglevGraphBuilder::CollectFieldAccesses(
+    const compiler::NamedAccessFeedback& feedback, FeedbackSlot slot,
+    compiler::AccessMode mode, ZoneVector<PolymorphicFieldAccess>* accesses) {
+  if (feedback.maps().empty() ||
+      feedback.maps().size() >
+          static_cast<size_t>(FLAG_max_valid_polymorphic_map_count)) {
+    return false;
+  }
+  for (const compiler::MapRef& map : feedback.maps()) {
+    // TODO(leszeks): Make GetFeedbackForPropertyAccess read the handler.
+    MaybeObjectHandle handler =
+        FeedbackNexusForSlot(slot).FindHandlerForMap(map.object());
+    if (handler.is_null() || !handler->IsSmi()) return false;
+    int smi_handler = handler->ToSmi().value();
+    if (mode == compiler::AccessMode::kLoad
+            ? !IsInlineableLoadFieldHandler(smi_handler)
+            : !IsInlineableStoreFieldHandler(smi_handler)) {
+      return false;
+    }
+    accesses->push_back({map, smi_handler});
+  }
+  return true;
+}
+
+void MaglevGraphBuilder::BuildMapCheck(
+    ValueNode* object, const ZoneVector<compiler::MapRef>& maps) {
+  DCHECK(!maps.empty());
+  if (maps.size() == 1) {
+    AddNewNode<CheckMaps>({object}, maps[0]);
+  } else {
+    AddNewNode<CheckMapsPolymorphic>({object}, maps);
+  }
+}
+
+namespace {
+
+bool HaveSameHandler(const ZoneVector<PolymorphicFieldAccess>& accesses) {
+  for (const PolymorphicFieldAccess& access : accesses) {
+    if (access.handler != accesses[0].handler) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void MaglevGraphBuilder::BuildLoadField(
+    ValueNode* object, const ZoneVector<PolymorphicFieldAccess>& accesses) {
+  if (HaveSameHandler(accesses)) {
+    // All maps have the field at the same location, so a single map check
+    // covers them all.
+    ZoneVector<compiler::MapRef> maps(zone());
+    for (const PolymorphicFieldAccess& access : accesses) {
+      maps.push_back(access.map);
+    }
+    BuildMapCheck(object, maps);
+    SetAccumulator(AddNewNode<LoadField>({object}, accesses[0].handler));
+    return;
+  }
+  SetAccumulator(AddNewNode<LoadPolymorphicField>({object}, accesses));
+}
+
+void MaglevGraphBuilder::BuildStoreField(
+    ValueNode* object, ValueNode* value,
+    const ZoneVector<PolymorphicFieldAccess>& accesses) {
+  if (HaveSameHandler(accesses)) {
+    ZoneVector<compiler::MapRef> maps(zone());
+    for (const PolymorphicFieldAccess& access : accesses) {
+      maps.push_back(access.map);
+    }
+    BuildMapCheck(object, maps);
+    if (StoreHandler::RepresentationBits::decode(accesses[0].handler) ==
+        Representation::kSmi) {
+      AddNewNode<CheckSmi>({value});
+    }
+    AddNewNode<StoreField>({object, value}, accesses[0].handler);
+    return;
+  }
+  AddNewNode<StorePolymorphicField>({object, value}, accesses);
+}
+
+bool MaglevGraphBuilder::TryBuildElementAccessMapCheck(
+    ValueNode* object, const compiler::ElementAccessFeedback& feedback,
+    ElementsKind* elements_kind) {
+  compiler::AccessMode mode = feedback.keyed_mode().access_mode();
+  if (feedback.keyed_mode().IsLoad()) {
+    if (feedback.keyed_mode().load_mode() != STANDARD_LOAD) return false;
+  } else if (feedback.keyed_mode().store_mode() != STANDARD_STORE) {
+    return false;
+  }
+  // TODO(v8:7700): Support elements kind transitions.
+  const ZoneVector<compiler::ElementAccessFeedback::TransitionGroup>& groups =
+      feedback.transition_groups();
+  if (groups.empty() ||
+      groups.size() >
+          static_cast<size_t>(FLAG_max_valid_polymorphic_map_count)) {
+    return false;
+  }
+  ZoneVector<compiler::MapRef> maps(zone());
+  for (const compiler::ElementAccessFeedback::TransitionGroup& group : groups) {
+    if (group.size() != 1) return false;
+    compiler::MapRef map = MakeRef(broker(), group.front());
+    if (!map.CanInlineElementAccess()) return false;
+    if (!maps.empty() && map.elements_kind() != maps[0].elements_kind()) {
+      return false;
+    }
+    maps.push_back(map);
+  }
+
+  ElementsKind kind = maps[0].elements_kind();
+  bool is_typed_array = false;
+  for (const compiler::MapRef& map : maps) {
+    if (map.IsJSArrayMap() && IsSupportedJSArrayElementsKind(kind)) continue;
+    if (map.IsJSTypedArrayMap() &&
+        IsSupportedTypedArrayElementsKind(kind, mode)) {
+      is_typed_array = true;
+      continue;
+    }
+    return false;
+  }
+  if (is_typed_array &&
+      !broker()->dependencies()->DependOnArrayBufferDetachingProtector()) {
+    return false;
+  }
+
+  BuildMapCheck(object, maps);
+  *elements_kind = kind;
+  return true;
+}
+
+bool MaglevGraphBuilder::TryBuildElementLoad(
+    ValueNode* object, const compiler::ElementAccessFeedback& feedback) {
+  ElementsKind elements_kind;
+  if (!TryBuildElementAccessMapCheck(object, feedback, &elements_kind)) {
+    return false;
+  }
+  ValueNode* index = GetAccumulatorInt32();
+  if (IsTypedArrayElementsKind(elements_kind)) {
+    SetAccumulator(
+        AddNewNode<LoadTypedArrayElement>({object, index}, elements_kind));
+  } else if (IsDoubleElementsKind(elements_kind)) {
+    SetAccumulator(AddNewNode<LoadDoubleElement>({object, index}));
+  } else {
+    SetAccumulator(AddNewNode<LoadTaggedElement>({object, index}));
+  }
+  return true;
+}
+
+bool MaglevGraphBuilder::TryBuildElementStore(
+    ValueNode* object, interpreter::Register key,
+    const compiler::ElementAccessFeedback& feedback) {
+  ElementsKind elements_kind;
+  if (!TryBuildElementAccessMapCheck(object, feedback, &elements_kind)) {
+    return false;
+  }
+  ValueNode* index = GetInt32(key);
+  if (IsTypedArrayElementsKind(elements_kind)) {
+    ValueNode* value = GetAccumulatorInt32();
+    AddNewNode<StoreTypedArrayElement>({object, index, value}, elements_kind);
+  } else if (IsDoubleElementsKind(elements_kind)) {
+    ValueNode* value = GetAccumulatorTagged();
+    AddNewNode<StoreDoubleElement>({object, index, value});
+  } else {
+    ValueNode* value = GetAccumulatorTagged();
+    AddNewNode<StoreTaggedElement>({object, index, value}, elements_kind);
+  }
+  return true;
+}
+
 void MaglevGraphBuilder::VisitLdaGlobal() {
   // LdaGlobal <name_index> <slot>
 
@@ -459,25 +700,11 @@ void MaglevGraphBuilder::VisitGetNamedProperty() {
       return;
 
     case compiler::ProcessedFeedback::kNamedAccess: {
-      const compiler::NamedAccessFeedback& named_feedback =
-          processed_feedback.AsNamedAccess();
-      if (named_feedback.maps().size() == 1) {
-        // Monomorphic load, check the handler.
-        // TODO(leszeks): Make GetFeedbackForPropertyAccess read the handler.
-        MaybeObjectHandle handler =
-            FeedbackNexusForSlot(slot).FindHandlerForMap(
-                named_feedback.maps()[0].object());
-        if (!handler.is_null() && handler->IsSmi()) {
-          // Smi handler, emit a map check and LoadField.
-          int smi_handler = handler->ToSmi().value();
-          LoadHandler::Kind kind = LoadHandler::KindBits::decode(smi_handler);
-          if (kind == LoadHandler::Kind::kField &&
-              !LoadHandler::IsWasmStructBits::decode(smi_handler)) {
-            AddNewNode<CheckMaps>({object}, named_feedback.maps()[0]);
-            SetAccumulator(AddNewNode<LoadField>({object}, smi_handler));
-            return;
-          }
-        }
+      ZoneVector<PolymorphicFieldAccess> accesses(zone());
+      if (CollectFieldAccesses(processed_feedback.AsNamedAccess(), slot,
+                               compiler::AccessMode::kLoad, &accesses)) {
+        BuildLoadField(object, accesses);
+        return;
       }
     } break;
 
@@ -492,7 +719,39 @@ void MaglevGraphBuilder::VisitGetNamedProperty() {
 }
 
 MAGLEV_UNIMPLEMENTED_BYTECODE(GetNamedPropertyFromSuper)
-MAGLEV_UNIMPLEMENTED_BYTECODE(GetKeyedProperty)
+
+void MaglevGraphBuilder::VisitGetKeyedProperty() {
+  // GetKeyedProperty <object> <slot>
+  ValueNode* object = LoadRegisterTagged(0);
+  FeedbackSlot slot = GetSlotOperand(1);
+  compiler::FeedbackSource feedback_source{feedback(), slot};
+
+  const compiler::ProcessedFeedback& processed_feedback =
+      broker()->GetFeedbackForPropertyAccess(
+          feedback_source, compiler::AccessMode::kLoad, base::nullopt);
+
+  switch (processed_feedback.kind()) {
+    case compiler::ProcessedFeedback::kInsufficient:
+      EmitUnconditionalDeopt();
+      return;
+
+    case compiler::ProcessedFeedback::kElementAccess:
+      if (TryBuildElementLoad(object, processed_feedback.AsElementAccess())) {
+        return;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  // Create a generic load in the fallthrough.
+  ValueNode* context = GetContext();
+  ValueNode* key = GetAccumulatorTagged();
+  SetAccumulator(
+      AddNewNode<GetKeyedGeneric>({context, object, key}, feedback_source));
+}
+
 MAGLEV_UNIMPLEMENTED_BYTECODE(LdaModuleVariable)
 MAGLEV_UNIMPLEMENTED_BYTECODE(StaModuleVariable)
 
@@ -513,24 +772,11 @@ void MaglevGraphBuilder::VisitSetNamedProperty() {
       return;
 
     case compiler::ProcessedFeedback::kNamedAccess: {
-      const compiler::NamedAccessFeedback& named_feedback =
-          processed_feedback.AsNamedAccess();
-      if (named_feedback.maps().size() == 1) {
-        // Monomorphic store, check the handler.
-        // TODO(leszeks): Make GetFeedbackForPropertyAccess read the handler.
-        MaybeObjectHandle handler =
-            FeedbackNexusForSlot(slot).FindHandlerForMap(
-                named_feedback.maps()[0].object());
-        if (!handler.is_null() && handler->IsSmi()) {
-          int smi_handler = handler->ToSmi().value();
-          StoreHandler::Kind kind = StoreHandler::KindBits::decode(smi_handler);
-          if (kind == StoreHandler::Kind::kField) {
-            AddNewNode<CheckMaps>({object}, named_feedback.maps()[0]);
-            ValueNode* value = GetAccumulatorTagged();
-            AddNewNode<StoreField>({object, value}, smi_handler);
-            return;
-          }
-        }
+      ZoneVector<PolymorphicFieldAccess> accesses(zone());
+      if (CollectFieldAccesses(processed_feedback.AsNamedAccess(), slot,
+                               compiler::AccessMode::kStore, &accesses)) {
+        BuildStoreField(object, GetAccumulatorTagged(), accesses);
+        return;
       }
     } break;
 
@@ -538,12 +784,47 @@ void MaglevGraphBuilder::VisitSetNamedProperty() {
       break;
   }
 
-  // TODO(victorgomes): Generic store.
-  MAGLEV_UNIMPLEMENTED(VisitSetNamedProperty);
+  // Create a generic store in the fallthrough.
+  ValueNode* context = GetContext();
+  ValueNode* value = GetAccumulatorTagged();
+  AddNewNode<SetNamedGeneric>({context, object, value}, name, feedback_source);
 }
 
 MAGLEV_UNIMPLEMENTED_BYTECODE(DefineNamedOwnProperty)
-MAGLEV_UNIMPLEMENTED_BYTECODE(SetKeyedProperty)
+
+void MaglevGraphBuilder::VisitSetKeyedProperty() {
+  // SetKeyedProperty <object> <key> <slot>
+  ValueNode* object = LoadRegisterTagged(0);
+  FeedbackSlot slot = GetSlotOperand(2);
+  compiler::FeedbackSource feedback_source{feedback(), slot};
+
+  const compiler::ProcessedFeedback& processed_feedback =
+      broker()->GetFeedbackForPropertyAccess(
+          feedback_source, compiler::AccessMode::kStore, base::nullopt);
+
+  switch (processed_feedback.kind()) {
+    case compiler::ProcessedFeedback::kInsufficient:
+      EmitUnconditionalDeopt();
+      return;
+
+    case compiler::ProcessedFeedback::kElementAccess:
+      if (TryBuildElementStore(object, iterator_.GetRegisterOperand(1),
+                               processed_feedback.AsElementAccess())) {
+        return;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  // Create a generic store in the fallthrough.
+  ValueNode* context = GetContext();
+  ValueNode* key = LoadRegisterTagged(1);
+  ValueNode* value = GetAccumulatorTagged();
+  AddNewNode<SetKeyedGeneric>({context, object, key, value}, feedback_source);
+}
+
 MAGLEV_UNIMPLEMENTED_BYTECODE(DefineKeyedOwnProperty)
 MAGLEV_UNIMPLEMENTED_BYTECODE(StaInArrayLiteral)
 MAGLEV_UNIMPLEMENTED_BYTECODE(DefineKeyedOwnPropertyInLiteral)
@@ -641,16 +922,68 @@ MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertyStrict)
 MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertySloppy)
 MAGLEV_UNIMPLEMENTED_BYTECODE(GetSuperConstructor)
 
+bool MaglevGraphBuilder::ShouldInlineCall(compiler::JSFunctionRef function,
+                                          int argc_count,
+                                          ConvertReceiverMode receiver_mode,
+                                          float call_frequency) {
+  if (compilation_unit_->inlining_depth() >= FLAG_max_maglev_inline_depth) {
+    return false;
+  }
+  if (!(call_frequency >= FLAG_min_maglev_inlining_frequency)) return false;
+
+  compiler::SharedFunctionInfoRef shared = function.shared();
+  if (!shared.IsInlineable()) return false;
+  if (shared.GetBytecodeArray().length() >
+      FLAG_max_maglev_inlined_bytecode_size) {
+    return false;
+  }
+  if (!function.feedback_vector(broker()->dependencies()).has_value()) {
+    return false;
+  }
+  // The deoptimizer materializes inlined frames with exactly the formal
+  // parameters, so we can't inline calls that would need an arguments
+  // adaptation.
+  if (argc_count !=
+      shared.internal_formal_parameter_count_without_receiver()) {
+    return false;
+  }
+  // Sloppy mode callees need an explicit receiver to be converted to an
+  // object, which we don't support yet.
+  if (is_sloppy(shared.language_mode()) &&
+      receiver_mode != ConvertReceiverMode::kNullOrUndefined) {
+    return false;
+  }
+  // An unsupported bytecode in the inlined body would fail the whole
+  // compilation, so emit a regular call to such functions instead.
+  // TODO(v8:7700): Clean up after all bytecodes are supported.
+  for (interpreter::BytecodeArrayIterator it(
+           shared.GetBytecodeArray().object());
+       !it.done(); it.Advance()) {
+    if (IsUnimplementedBytecode(it.current_bytecode())) return false;
+  }
+  return true;
+}
+
 void MaglevGraphBuilder::InlineCallFromRegisters(
     int argc_count, ConvertReceiverMode receiver_mode,
     compiler::JSFunctionRef function) {
-  // The undefined constant node has to be created before the inner graph is
-  // created.
-  RootConstant* undefined_constant;
-  if (receiver_mode == ConvertReceiverMode::kNullOrUndefined) {
-    undefined_constant =
-        AddNewNode<RootConstant>({}, RootIndex::kUndefinedValue);
+  // Take a fresh checkpoint at the call, which is where the caller's frame
+  // resumes if we deopt in the inlined function.
+  MarkPossibleSideEffect();
+
+  // Deopt if the call target isn't the function we inline.
+  ValueNode* callee = LoadRegisterTagged(0);
+  AddNewNode<CheckValue>({callee}, function);
+
+  // The constant nodes have to be created before the inner graph is created.
+  RootConstant* undefined_constant =
+      AddNewNode<RootConstant>({}, RootIndex::kUndefinedValue);
+  ValueNode* receiver = undefined_constant;
+  if (receiver_mode == ConvertReceiverMode::kNullOrUndefined &&
+      is_sloppy(function.shared().language_mode())) {
+    receiver = GetConstant(function.native_context().global_proxy_object());
   }
+  ValueNode* context = GetConstant(function.context());
 
   // Create a new compilation unit and graph builder for the inlined
   // function.
@@ -672,12 +1005,7 @@ void MaglevGraphBuilder::InlineCallFromRegisters(
   int reg_count;
   if (receiver_mode == ConvertReceiverMode::kNullOrUndefined) {
     reg_count = argc_count;
-    if (function.shared().language_mode() == LanguageMode::kSloppy) {
-      // TODO(leszeks): Store the global proxy somehow.
-      inner_graph_builder.SetArgument(arg_index++, undefined_constant);
-    } else {
-      inner_graph_builder.SetArgument(arg_index++, undefined_constant);
-    }
+    inner_graph_builder.SetArgument(arg_index++, receiver);
   } else {
     reg_count = argc_count + 1;
   }
@@ -687,9 +1015,7 @@ void MaglevGraphBuilder::InlineCallFromRegisters(
   for (; arg_index < inner_unit->parameter_count(); arg_index++) {
     inner_graph_builder.SetArgument(arg_index, undefined_constant);
   }
-  // TODO(leszeks): Also correctly set up the closure and context slots, instead
-  // of using InitialValue.
-  inner_graph_builder.BuildRegisterFrameInitialization();
+  inner_graph_builder.BuildRegisterFrameInitialization(context, callee);
   BasicBlock* inlined_prologue = inner_graph_builder.EndPrologue();
 
   // Set the entry JumpToInlined to jump to the prologue block.
@@ -701,6 +1027,11 @@ void MaglevGraphBuilder::InlineCallFromRegisters(
 
   // Build the inlined function body.
   inner_graph_builder.BuildBody();
+  // TODO(v8:7700): Clean up after all bytecodes are supported.
+  if (inner_graph_builder.found_unsupported_bytecode()) {
+    found_unsupported_bytecode_ = true;
+    return;
+  }
 
   // All returns in the inlined body jump to a merge point one past the
   // bytecode length (i.e. at offset bytecode.length()). Create a block at
@@ -720,6 +1051,9 @@ void MaglevGraphBuilder::InlineCallFromRegisters(
   // merged return state.
   current_interpreter_frame_.set_accumulator(
       inner_graph_builder.current_interpreter_frame_.accumulator());
+  // The call had side effects, so later deopts can't reuse the checkpoint at
+  // the call.
+  MarkPossibleSideEffect();
 
   // Create a new block at our current offset, and resume execution. Do this
   // manually to avoid trying to resolve any merges to this offset, which will
@@ -804,10 +1138,10 @@ void MaglevGraphBuilder::BuildCallFromRegisters(
       if (!target.IsJSFunction()) break;
 
       compiler::JSFunctionRef function = target.AsJSFunction();
-      base::Optional<compiler::FeedbackVectorRef> maybe_feedback_vector =
-          function.feedback_vector(broker()->dependencies());
-      if (!maybe_feedback_vector.has_value()) break;
-
+      if (!ShouldInlineCall(function, argc_count, receiver_mode,
+                            call_feedback.frequency())) {
+        break;
+      }
       return InlineCallFromRegisters(argc_count, receiver_mode, function);
     }
 
@@ -1095,6 +1429,19 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK)
 #undef DEBUG_BREAK
 void MaglevGraphBuilder::VisitIllegal() { UNREACHABLE(); }
 
+namespace {
+bool IsUnimplementedBytecode(interpreter::Bytecode bytecode) {
+  switch (bytecode) {
+#define CASE(Name, ...)              \
+  case interpreter::Bytecode::k##Name: \
+    return kIsUnimplementedBytecode<interpreter::Bytecode::k##Name>;
+    BYTECODE_LIST(CASE)
+#undef CASE
+  }
+  UNREACHABLE();
+}
+}  // namespace
+
 }  // namespace maglev
 }  // namespace internal
 }  // namespace v8
@@ -45,7 +45,10 @@ class MaglevGraphBuilder {
 
   void StartPrologue();
   void SetArgument(int i, ValueNode* value);
-  void BuildRegisterFrameInitialization();
+  // Inlined functions pass in their context and closure, everything else
+  // reads them from the incoming frame.
+  void BuildRegisterFrameInitialization(ValueNode* context = nullptr,
+                                        ValueNode* closure = nullptr);
   BasicBlock* EndPrologue();
 
   void BuildBody() {
@@ -310,7 +313,8 @@ class MaglevGraphBuilder {
     if (value->Is<CheckedSmiUntag>()) {
       return value->input(0).node();
     }
-    DCHECK(value->Is<Int32AddWithOverflow>() || value->Is<Int32Constant>());
+    DCHECK(value->Is<Int32AddWithOverflow>() || value->Is<Int32Constant>() ||
+           value->Is<LoadTypedArrayElement>());
     ValueNode* tagged = AddNewNode<CheckedSmiTag>({value});
     current_interpreter_frame_.set(reg, tagged);
     return tagged;
@@ -394,8 +398,11 @@ class MaglevGraphBuilder {
         BytecodeOffset(iterator_.current_offset()),
         zone()->New<CompactInterpreterFrameState>(
             *compilation_unit_, GetOutLiveness(), current_interpreter_frame_),
-        // TODO(leszeks): Support lazy deopts in inlined functions.
-        nullptr);
+        // The caller frames are checkpointed at the call that was inlined, so
+        // they are the same for lazy and eager deopts.
+        parent_ == nullptr ? nullptr
+                           : zone()->New<CheckpointedInterpreterState>(
+                                 parent_->GetLatestCheckpointedState()));
   }
 
   template <typename NodeT>
@@ -487,6 +494,9 @@ class MaglevGraphBuilder {
     return block;
   }
 
+  bool ShouldInlineCall(compiler::JSFunctionRef function, int argc_count,
+                        ConvertReceiverMode receiver_mode,
+                        float call_frequency);
   void InlineCallFromRegisters(int argc_count,
                                ConvertReceiverMode receiver_mode,
                                compiler::JSFunctionRef function);
@@ -497,6 +507,28 @@ class MaglevGraphBuilder {
 
   void BuildPropertyCellAccess(const compiler::PropertyCellRef& property_cell);
 
+  // Collects the field access handlers for all maps of a named access, and
+  // returns false if any of them isn't a field access we can inline.
+  bool CollectFieldAccesses(const compiler::NamedAccessFeedback& feedback,
+                            FeedbackSlot slot, compiler::AccessMode mode,
+                            ZoneVector<PolymorphicFieldAccess>* accesses);
+  void BuildMapCheck(ValueNode* object,
+                     const ZoneVector<compiler::MapRef>& maps);
+  void BuildLoadField(ValueNode* object,
+                      const ZoneVector<PolymorphicFieldAccess>& accesses);
+  void BuildStoreField(ValueNode* object, ValueNode* value,
+                       const ZoneVector<PolymorphicFieldAccess>& accesses);
+
+  // Checks that all maps of an element access have the same, supported
+  // elements kind, and emits the map check.
+  bool TryBuildElementAccessMapCheck(
+      ValueNode* object, const compiler::ElementAccessFeedback& feedback,
+      ElementsKind* elements_kind);
+  bool TryBuildElementLoad(ValueNode* object,
+                           const compiler::ElementAccessFeedback& feedback);
+  bool TryBuildElementStore(ValueNode* object, interpreter::Register key,
+                            const compiler::ElementAccessFeedback& feedback);
+
   template <Operation kOperation>
   void BuildGenericUnaryOperationNode();
   template <Operation kOperation>
@@ -302,6 +302,21 @@ void MaglevPrintingVisitor::PreProcessBasicBlock(
 
 namespace {
 
+// The input locations of the caller frames come before the ones of the
+// innermost frame, which is the one we print.
+int CallerFramesInputLocationCount(const MaglevCompilationUnit& unit,
+                                   const CheckpointedInterpreterState& state) {
+  int count = 0;
+  const CheckpointedInterpreterState* parent = state.parent;
+  const MaglevCompilationUnit* parent_unit = unit.caller();
+  while (parent != nullptr) {
+    count += static_cast<int>(parent->register_frame->size(*parent_unit));
+    parent = parent->parent;
+    parent_unit = parent_unit->caller();
+  }
+  return count;
+}
+
 template <typename NodeT>
 void PrintEagerDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
                      NodeT* node, const ProcessingState& state) {
@@ -313,7 +328,8 @@ void PrintEagerDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
   EagerDeoptInfo* deopt_info = node->eager_deopt_info();
   os << "  ↱ eager @" << deopt_info->state.bytecode_position << " : {";
   bool first = true;
-  int index = 0;
+  int index =
+      CallerFramesInputLocationCount(deopt_info->unit, deopt_info->state);
   deopt_info->state.register_frame->ForEachValue(
       deopt_info->unit, [&](ValueNode* node, interpreter::Register reg) {
         if (first) {
@@ -352,7 +368,8 @@ void PrintLazyDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
   LazyDeoptInfo* deopt_info = node->lazy_deopt_info();
   os << "  ↳ lazy @" << deopt_info->state.bytecode_position << " : {";
   bool first = true;
-  int index = 0;
+  int index =
+      CallerFramesInputLocationCount(deopt_info->unit, deopt_info->state);
   deopt_info->state.register_frame->ForEachValue(
       deopt_info->unit, [&](ValueNode* node, interpreter::Register reg) {
         if (first) {
@@ -366,8 +383,8 @@ void PrintLazyDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
         } else {
           os << PrintNodeLabel(graph_labeller, node) << ":"
              << deopt_info->input_locations[index].operand();
+          index++;
         }
-        index++;
       });
   os << "}\n";
 }
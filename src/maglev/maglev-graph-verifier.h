@@ -84,6 +84,10 @@ class MaglevGraphVerifier {
       case Opcode::kLoadGlobal:
       // TODO(victorgomes): Can we check that the input is actually a map?
       case Opcode::kCheckMaps:
+      case Opcode::kCheckMapsPolymorphic:
+      case Opcode::kCheckSmi:
+      case Opcode::kCheckValue:
+      case Opcode::kLoadPolymorphicField:
       // TODO(victorgomes): Can we check that the input is Boolean?
       case Opcode::kBranchIfTrue:
       case Opcode::kBranchIfToBooleanTrue:
@@ -118,6 +122,7 @@ class MaglevGraphVerifier {
       case Opcode::kGenericGreaterThanOrEqual:
       // TODO(victorgomes): Can we check that first input is an Object?
       case Opcode::kStoreField:
+      case Opcode::kStorePolymorphicField:
       case Opcode::kLoadNamedGeneric:
         // Generic tagged binary operations.
         DCHECK_EQ(node->input_count(), 2);
@@ -129,6 +134,32 @@ class MaglevGraphVerifier {
         CheckValueInputIs(node, 0, ValueRepresentation::kInt32);
         CheckValueInputIs(node, 1, ValueRepresentation::kInt32);
         break;
+      case Opcode::kLoadTaggedElement:
+      case Opcode::kLoadDoubleElement:
+      case Opcode::kLoadTypedArrayElement:
+        // Element loads with an untagged index.
+        DCHECK_EQ(node->input_count(), 2);
+        CheckValueInputIs(node, 0, ValueRepresentation::kTagged);
+        CheckValueInputIs(node, 1, ValueRepresentation::kInt32);
+        break;
+      case Opcode::kStoreTaggedElement:
+      case Opcode::kStoreDoubleElement:
+        // Element stores with an untagged index.
+        DCHECK_EQ(node->input_count(), 3);
+        CheckValueInputIs(node, 0, ValueRepresentation::kTagged);
+        CheckValueInputIs(node, 1, ValueRepresentation::kInt32);
+        CheckValueInputIs(node, 2, ValueRepresentation::kTagged);
+        break;
+      case Opcode::kStoreTypedArrayElement:
+        // Element stores with an untagged index and value.
+        DCHECK_EQ(node->input_count(), 3);
+        CheckValueInputIs(node, 0, ValueRepresentation::kTagged);
+        CheckValueInputIs(node, 1, ValueRepresentation::kInt32);
+        CheckValueInputIs(node, 2, ValueRepresentation::kInt32);
+        break;
+      case Opcode::kSetNamedGeneric:
+      case Opcode::kGetKeyedGeneric:
+      case Opcode::kSetKeyedGeneric:
       case Opcode::kCall:
       case Opcode::kPhi:
         // All inputs should be tagged.
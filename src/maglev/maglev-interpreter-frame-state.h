@@ -248,7 +248,8 @@ class MergePointInterpreterFrameState {
       const MaglevCompilationUnit& info, const InterpreterFrameState& state,
       int merge_offset, int predecessor_count, BasicBlock* predecessor,
       const compiler::BytecodeLivenessState* liveness)
-      : predecessor_count_(predecessor_count),
+      : compilation_unit_(&info),
+        predecessor_count_(predecessor_count),
         predecessors_so_far_(1),
         predecessors_(info.zone()->NewArray<BasicBlock*>(predecessor_count)),
         frame_state_(info, liveness, state) {
@@ -259,7 +260,8 @@ class MergePointInterpreterFrameState {
       const MaglevCompilationUnit& info, int merge_offset,
       int predecessor_count, const compiler::BytecodeLivenessState* liveness,
       const compiler::LoopInfo* loop_info)
-      : predecessor_count_(predecessor_count),
+      : compilation_unit_(&info),
+        predecessor_count_(predecessor_count),
         predecessors_so_far_(1),
         predecessors_(info.zone()->NewArray<BasicBlock*>(predecessor_count)),
         frame_state_(info, liveness) {
@@ -347,6 +349,9 @@ class MergePointInterpreterFrameState {
     predecessors_[0] = kDeadPredecessor;
   }
 
+  const MaglevCompilationUnit& compilation_unit() const {
+    return *compilation_unit_;
+  }
   const CompactInterpreterFrameState& frame_state() const {
     return frame_state_;
   }
@@ -389,7 +394,8 @@ class MergePointInterpreterFrameState {
     if (value->Is<CheckedSmiUntag>()) {
       return value->input(0).node();
     }
-    DCHECK(value->Is<Int32AddWithOverflow>() || value->Is<Int32Constant>());
+    DCHECK(value->Is<Int32AddWithOverflow>() || value->Is<Int32Constant>() ||
+           value->Is<LoadTypedArrayElement>());
     // Check if the next Node in the block after value is its CheckedSmiTag
     // version and reuse it.
     if (value->NextNode()) {
@@ -503,6 +509,7 @@ class MergePointInterpreterFrameState {
 #ifdef DEBUG
     DCHECK_NULL(result->input(0).node());
 #endif
+    unmerged = EnsureTagged(compilation_unit, unmerged);
     result->set_input(0, unmerged);
   }
 
@@ -518,6 +525,7 @@ class MergePointInterpreterFrameState {
     return result;
   }
 
+  const MaglevCompilationUnit* compilation_unit_;
   int predecessor_count_;
   int predecessors_so_far_;
   Phi::List phis_;
@@ -270,6 +270,104 @@ void EmitEagerDeoptIf(Condition cond, MaglevCodeGenState* code_gen_state,
   EmitEagerDeoptIf(cond, code_gen_state, node->eager_deopt_info());
 }
 
+// ---
+// Field and element access
+// ---
+
+void EmitLoadField(MaglevCodeGenState* code_gen_state, Register object,
+                   Register result, int handler) {
+  DCHECK_EQ(LoadHandler::KindBits::decode(handler), LoadHandler::Kind::kField);
+  DCHECK(!LoadHandler::IsDoubleBits::decode(handler));
+  if (LoadHandler::IsInobjectBits::decode(handler)) {
+    Operand input_field_operand = FieldOperand(
+        object, LoadHandler::FieldIndexBits::decode(handler) * kTaggedSize);
+    __ DecompressAnyTagged(result, input_field_operand);
+  } else {
+    Operand property_array_operand =
+        FieldOperand(object, JSReceiver::kPropertiesOrHashOffset);
+    __ DecompressAnyTagged(result, property_array_operand);
+
+    __ AssertNotSmi(result);
+
+    Operand input_field_operand = FieldOperand(
+        result, LoadHandler::FieldIndexBits::decode(handler) * kTaggedSize);
+    __ DecompressAnyTagged(result, input_field_operand);
+  }
+}
+
+// Stores to an in-object field. Values stored to Smi fields must already have
+// been checked to be Smis. Clobbers both scratch registers.
+void EmitStoreField(MaglevCodeGenState* code_gen_state, Register object,
+                    Register value, int handler, Register value_scratch,
+                    Register slot_scratch) {
+  DCHECK_EQ(StoreHandler::KindBits::decode(handler),
+            StoreHandler::Kind::kField);
+  DCHECK(StoreHandler::IsInobjectBits::decode(handler));
+  int offset = StoreHandler::FieldIndexBits::decode(handler) * kTaggedSize;
+  __ StoreTaggedField(FieldOperand(object, offset), value);
+
+  switch (StoreHandler::RepresentationBits::decode(handler)) {
+    case Representation::kSmi:
+      break;
+    case Representation::kTagged:
+      // The write barrier clobbers the value register.
+      __ movq(value_scratch, value);
+      __ RecordWriteField(object, offset, value_scratch, slot_scratch,
+                          SaveFPRegsMode::kIgnore);
+      break;
+    default:
+      UNREACHABLE();
+  }
+}
+
+// Deopts unless {index} is within the length of the JSArray {object}.
+void EmitJSArrayBoundsCheck(MaglevCodeGenState* code_gen_state,
+                            Register object, Register index, Register scratch,
+                            EagerDeoptInfo* deopt_info) {
+  __ SmiUntagField(scratch, FieldOperand(object, JSArray::kLengthOffset));
+  // The unsigned comparison also deopts on negative indices.
+  __ cmpl(index, scratch);
+  EmitEagerDeoptIf(above_equal, code_gen_state, deopt_info);
+}
+
+// Deopts unless {index} is within the length of the JSTypedArray {object},
+// and computes the typed array's data pointer into {data_pointer}.
+void EmitTypedArrayDataPointer(MaglevCodeGenState* code_gen_state,
+                               Register object, Register index,
+                               Register data_pointer, Register scratch,
+                               EagerDeoptInfo* deopt_info) {
+  // The length is a size_t, so compare against the sign extended index to
+  // deopt on negative indices.
+  __ movsxlq(scratch, index);
+  __ cmpq(scratch, FieldOperand(object, JSTypedArray::kLengthOffset));
+  EmitEagerDeoptIf(above_equal, code_gen_state, deopt_info);
+
+  // The data pointer is the external pointer plus the (zero-extended, for
+  // compressed pointers) base pointer, see JSTypedArray::DataPtr.
+  __ LoadSandboxedPointerField(
+      data_pointer, FieldOperand(object, JSTypedArray::kExternalPointerOffset));
+  if (COMPRESS_POINTERS_BOOL) {
+    __ movl(scratch, FieldOperand(object, JSTypedArray::kBasePointerOffset));
+  } else {
+    __ movq(scratch, FieldOperand(object, JSTypedArray::kBasePointerOffset));
+  }
+  __ addq(data_pointer, scratch);
+}
+
+ScaleFactor TypedArrayScaleFactor(ElementsKind kind) {
+  switch (ElementsKindToShiftSize(kind)) {
+    case 0:
+      return times_1;
+    case 1:
+      return times_2;
+    case 2:
+      return times_4;
+    case 3:
+      return times_8;
+  }
+  UNREACHABLE();
+}
+
 // ---
 // Print
 // ---
@@ -531,6 +629,67 @@ void CheckMaps::PrintParams(std::ostream& os,
   os << "(" << *map().object() << ")";
 }
 
+void CheckMapsPolymorphic::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                        const ProcessingState& state) {
+  UseRegister(actual_map_input());
+  set_temporaries_needed(1);
+}
+void CheckMapsPolymorphic::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                        const ProcessingState& state) {
+  Register object = ToRegister(actual_map_input());
+  RegList temps = temporaries();
+  Register map_tmp = temps.PopFirst();
+
+  Condition is_smi = __ CheckSmi(object);
+  EmitEagerDeoptIf(is_smi, code_gen_state, this);
+  __ LoadMap(map_tmp, object);
+
+  Label done;
+  size_t map_count = maps().size();
+  for (size_t i = 0; i < map_count - 1; i++) {
+    __ Cmp(map_tmp, maps()[i].object());
+    __ j(equal, &done);
+  }
+  __ Cmp(map_tmp, maps()[map_count - 1].object());
+  EmitEagerDeoptIf(not_equal, code_gen_state, this);
+  __ bind(&done);
+}
+void CheckMapsPolymorphic::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(";
+  for (size_t i = 0; i < maps().size(); i++) {
+    if (i != 0) os << ", ";
+    os << *maps()[i].object();
+  }
+  os << ")";
+}
+
+void CheckSmi::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                            const ProcessingState& state) {
+  UseRegister(receiver_input());
+}
+void CheckSmi::GenerateCode(MaglevCodeGenState* code_gen_state,
+                            const ProcessingState& state) {
+  Register object = ToRegister(receiver_input());
+  Condition is_smi = __ CheckSmi(object);
+  EmitEagerDeoptIf(NegateCondition(is_smi), code_gen_state, this);
+}
+
+void CheckValue::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                              const ProcessingState& state) {
+  UseRegister(target_input());
+}
+void CheckValue::GenerateCode(MaglevCodeGenState* code_gen_state,
+                              const ProcessingState& state) {
+  Register target = ToRegister(target_input());
+  __ Cmp(target, value().object());
+  EmitEagerDeoptIf(not_equal, code_gen_state, this);
+}
+void CheckValue::PrintParams(std::ostream& os,
+                             MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << *value().object() << ")";
+}
+
 void LoadField::AllocateVreg(MaglevVregAllocationState* vreg_state,
                              const ProcessingState& state) {
   UseRegister(object_input());
@@ -538,36 +697,14 @@ void LoadField::AllocateVreg(MaglevVregAllocationState* vreg_state,
 }
 void LoadField::GenerateCode(MaglevCodeGenState* code_gen_state,
                              const ProcessingState& state) {
-  // os << "kField, is in object = "
-  //    << LoadHandler::IsInobjectBits::decode(raw_handler)
-  //    << ", is double = " << LoadHandler::IsDoubleBits::decode(raw_handler)
-  //    << ", field index = " <<
-  //    LoadHandler::FieldIndexBits::decode(raw_handler);
-
-  Register object = ToRegister(object_input());
-  Register res = ToRegister(result());
   int handler = this->handler();
-
-  if (LoadHandler::IsInobjectBits::decode(handler)) {
-    Operand input_field_operand = FieldOperand(
-        object, LoadHandler::FieldIndexBits::decode(handler) * kTaggedSize);
-    __ DecompressAnyTagged(res, input_field_operand);
-  } else {
-    Operand property_array_operand =
-        FieldOperand(object, JSReceiver::kPropertiesOrHashOffset);
-    __ DecompressAnyTagged(res, property_array_operand);
-
-    __ AssertNotSmi(res);
-
-    Operand input_field_operand = FieldOperand(
-        res, LoadHandler::FieldIndexBits::decode(handler) * kTaggedSize);
-    __ DecompressAnyTagged(res, input_field_operand);
-  }
-
   if (LoadHandler::IsDoubleBits::decode(handler)) {
     // TODO(leszeks): Copy out the value, either as a double or a HeapNumber.
     UNSUPPORTED("LoadField double property");
+    return;
   }
+  EmitLoadField(code_gen_state, ToRegister(object_input()),
+                ToRegister(result()), handler);
 }
 void LoadField::PrintParams(std::ostream& os,
                             MaglevGraphLabeller* graph_labeller) const {
@@ -578,6 +715,7 @@ void StoreField::AllocateVreg(MaglevVregAllocationState* vreg_state,
                               const ProcessingState& state) {
   UseRegister(object_input());
   UseRegister(value_input());
+  set_temporaries_needed(2);
 }
 void StoreField::GenerateCode(MaglevCodeGenState* code_gen_state,
                               const ProcessingState& state) {
@@ -585,10 +723,11 @@ void StoreField::GenerateCode(MaglevCodeGenState* code_gen_state,
   Register value = ToRegister(value_input());
 
   if (StoreHandler::IsInobjectBits::decode(this->handler())) {
-    Operand operand = FieldOperand(
-        object,
-        StoreHandler::FieldIndexBits::decode(this->handler()) * kTaggedSize);
-    __ StoreTaggedField(operand, value);
+    RegList temps = temporaries();
+    Register value_scratch = temps.PopFirst();
+    Register slot_scratch = temps.PopFirst();
+    EmitStoreField(code_gen_state, object, value, this->handler(),
+                   value_scratch, slot_scratch);
   } else {
     // TODO(victorgomes): Out-of-object properties.
     UNSUPPORTED("StoreField out-of-object property");
@@ -600,6 +739,355 @@ void StoreField::PrintParams(std::ostream& os,
   os << "(" << std::hex << handler() << std::dec << ")";
 }
 
+void LoadPolymorphicField::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                        const ProcessingState& state) {
+  UseRegister(object_input());
+  DefineAsRegister(vreg_state, this);
+  set_temporaries_needed(1);
+}
+void LoadPolymorphicField::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                        const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  Register res = ToRegister(result());
+  RegList temps = temporaries();
+  Register map_tmp = temps.PopFirst();
+
+  Condition is_smi = __ CheckSmi(object);
+  EmitEagerDeoptIf(is_smi, code_gen_state, this);
+  __ LoadMap(map_tmp, object);
+
+  // Each map gets its own load, the last map check deopts on mismatch.
+  Label done;
+  size_t access_count = accesses().size();
+  for (size_t i = 0; i < access_count; i++) {
+    const PolymorphicFieldAccess& access = accesses()[i];
+    Label next;
+    __ Cmp(map_tmp, access.map.object());
+    if (i == access_count - 1) {
+      EmitEagerDeoptIf(not_equal, code_gen_state, this);
+    } else {
+      __ j(not_equal, &next);
+    }
+    EmitLoadField(code_gen_state, object, res, access.handler);
+    if (i != access_count - 1) {
+      __ jmp(&done);
+      __ bind(&next);
+    }
+  }
+  __ bind(&done);
+}
+void LoadPolymorphicField::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(";
+  for (size_t i = 0; i < accesses().size(); i++) {
+    if (i != 0) os << ", ";
+    os << *accesses()[i].map.object() << ": " << std::hex
+       << accesses()[i].handler << std::dec;
+  }
+  os << ")";
+}
+
+void StorePolymorphicField::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                         const ProcessingState& state) {
+  UseRegister(object_input());
+  UseRegister(value_input());
+  set_temporaries_needed(2);
+}
+void StorePolymorphicField::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                         const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  Register value = ToRegister(value_input());
+  RegList temps = temporaries();
+  Register map_tmp = temps.PopFirst();
+  Register slot_tmp = temps.PopFirst();
+
+  Condition is_smi = __ CheckSmi(object);
+  EmitEagerDeoptIf(is_smi, code_gen_state, this);
+  __ LoadMap(map_tmp, object);
+
+  // Each map gets its own store, the last map check deopts on mismatch. The
+  // map register is reused as a scratch register by the store.
+  Label done;
+  size_t access_count = accesses().size();
+  for (size_t i = 0; i < access_count; i++) {
+    const PolymorphicFieldAccess& access = accesses()[i];
+    Label next;
+    __ Cmp(map_tmp, access.map.object());
+    if (i == access_count - 1) {
+      EmitEagerDeoptIf(not_equal, code_gen_state, this);
+    } else {
+      __ j(not_equal, &next);
+    }
+    if (StoreHandler::RepresentationBits::decode(access.handler) ==
+        Representation::kSmi) {
+      Condition value_is_smi = __ CheckSmi(value);
+      EmitEagerDeoptIf(NegateCondition(value_is_smi), code_gen_state, this);
+    }
+    EmitStoreField(code_gen_state, object, value, access.handler, map_tmp,
+                   slot_tmp);
+    if (i != access_count - 1) {
+      __ jmp(&done);
+      __ bind(&next);
+    }
+  }
+  __ bind(&done);
+}
+void StorePolymorphicField::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(";
+  for (size_t i = 0; i < accesses().size(); i++) {
+    if (i != 0) os << ", ";
+    os << *accesses()[i].map.object() << ": " << std::hex
+       << accesses()[i].handler << std::dec;
+  }
+  os << ")";
+}
+
+void LoadTaggedElement::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                     const ProcessingState& state) {
+  UseRegister(object_input());
+  UseRegister(index_input());
+  DefineAsRegister(vreg_state, this);
+  set_temporaries_needed(1);
+}
+void LoadTaggedElement::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                     const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  Register index = ToRegister(index_input());
+  Register res = ToRegister(result());
+  RegList temps = temporaries();
+  Register elements = temps.PopFirst();
+
+  EmitJSArrayBoundsCheck(code_gen_state, object, index, elements,
+                         eager_deopt_info());
+  __ DecompressTaggedPointer(elements,
+                             FieldOperand(object, JSObject::kElementsOffset));
+  __ DecompressAnyTagged(res, FieldOperand(elements, index, times_tagged_size,
+                                           FixedArray::kHeaderSize));
+}
+
+void LoadDoubleElement::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                     const ProcessingState& state) {
+  UseRegister(object_input());
+  UseRegister(index_input());
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+  set_temporaries_needed(2);
+}
+void LoadDoubleElement::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                     const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  Register index = ToRegister(index_input());
+  RegList temps = temporaries();
+  // The runtime call returns the HeapNumber in the result register, so we
+  // need a temporary that doesn't alias it.
+  temps.clear(kReturnRegister0);
+  Register scratch = temps.PopFirst();
+
+  EmitJSArrayBoundsCheck(code_gen_state, object, index, scratch,
+                         eager_deopt_info());
+
+  // Keep the receiver and the (Smi tagged, in-bounds) index alive across the
+  // allocation. Both are tagged, so they can be visited by the GC.
+  __ Push(object);
+  __ movl(scratch, index);
+  __ SmiTag(scratch);
+  __ Push(scratch);
+  __ Move(kContextRegister, code_gen_state->native_context().object());
+  __ CallRuntime(Runtime::kAllocateHeapNumber);
+  SafepointTableBuilder::Safepoint safepoint =
+      code_gen_state->safepoint_table_builder()->DefineSafepoint(
+          code_gen_state->masm());
+  code_gen_state->DefineSafepointStackSlots(safepoint);
+  __ Pop(kScratchRegister);
+  __ SmiUntag(kScratchRegister);
+  __ Pop(scratch);
+
+  __ DecompressTaggedPointer(scratch,
+                             FieldOperand(scratch, JSObject::kElementsOffset));
+  __ Movsd(kScratchDoubleReg,
+           FieldOperand(scratch, kScratchRegister, times_8,
+                        FixedDoubleArray::kHeaderSize));
+  __ Movsd(FieldOperand(kReturnRegister0, HeapNumber::kValueOffset),
+           kScratchDoubleReg);
+}
+
+void LoadTypedArrayElement::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                         const ProcessingState& state) {
+  UseRegister(object_input());
+  UseRegister(index_input());
+  DefineAsRegister(vreg_state, this);
+  set_temporaries_needed(1);
+}
+void LoadTypedArrayElement::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                         const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  Register index = ToRegister(index_input());
+  Register res = ToRegister(result());
+  RegList temps = temporaries();
+  Register data_pointer = temps.PopFirst();
+
+  EmitTypedArrayDataPointer(code_gen_state, object, index, data_pointer,
+                            kScratchRegister, eager_deopt_info());
+  Operand element_operand(data_pointer, index,
+                          TypedArrayScaleFactor(elements_kind()), 0);
+  switch (elements_kind()) {
+    case INT8_ELEMENTS:
+      __ movsxbl(res, element_operand);
+      break;
+    case UINT8_ELEMENTS:
+    case UINT8_CLAMPED_ELEMENTS:
+      __ movzxbl(res, element_operand);
+      break;
+    case INT16_ELEMENTS:
+      __ movsxwl(res, element_operand);
+      break;
+    case UINT16_ELEMENTS:
+      __ movzxwl(res, element_operand);
+      break;
+    case INT32_ELEMENTS:
+      __ movl(res, element_operand);
+      break;
+    default:
+      UNREACHABLE();
+  }
+}
+void LoadTypedArrayElement::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << ElementsKindToString(elements_kind()) << ")";
+}
+
+void StoreTaggedElement::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                      const ProcessingState& state) {
+  UseRegister(object_input());
+  UseRegister(index_input());
+  UseRegister(value_input());
+  set_temporaries_needed(3);
+}
+void StoreTaggedElement::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                      const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  Register index = ToRegister(index_input());
+  Register value = ToRegister(value_input());
+  RegList temps = temporaries();
+  Register elements = temps.PopFirst();
+  Register value_scratch = temps.PopFirst();
+  Register slot_scratch = temps.PopFirst();
+
+  EmitJSArrayBoundsCheck(code_gen_state, object, index, elements,
+                         eager_deopt_info());
+  if (elements_kind() == PACKED_SMI_ELEMENTS) {
+    Condition is_smi = __ CheckSmi(value);
+    EmitEagerDeoptIf(NegateCondition(is_smi), code_gen_state, this);
+  } else {
+    DCHECK_EQ(elements_kind(), PACKED_ELEMENTS);
+  }
+
+  __ DecompressTaggedPointer(elements,
+                             FieldOperand(object, JSObject::kElementsOffset));
+  // Copy-on-write elements have to be copied before storing to them.
+  __ CompareRoot(FieldOperand(elements, HeapObject::kMapOffset),
+                 RootIndex::kFixedCOWArrayMap);
+  EmitEagerDeoptIf(equal, code_gen_state, this);
+
+  Operand element_operand = FieldOperand(elements, index, times_tagged_size,
+                                         FixedArray::kHeaderSize);
+  __ StoreTaggedField(element_operand, value);
+  if (elements_kind() == PACKED_ELEMENTS) {
+    // The write barrier clobbers the value register.
+    __ movq(value_scratch, value);
+    __ leaq(slot_scratch, element_operand);
+    __ RecordWrite(elements, slot_scratch, value_scratch,
+                   SaveFPRegsMode::kIgnore);
+  }
+}
+void StoreTaggedElement::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << ElementsKindToString(elements_kind()) << ")";
+}
+
+void StoreDoubleElement::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                      const ProcessingState& state) {
+  UseRegister(object_input());
+  UseRegister(index_input());
+  UseRegister(value_input());
+  set_temporaries_needed(1);
+}
+void StoreDoubleElement::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                      const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  Register index = ToRegister(index_input());
+  Register value = ToRegister(value_input());
+  RegList temps = temporaries();
+  Register scratch = temps.PopFirst();
+
+  EmitJSArrayBoundsCheck(code_gen_state, object, index, scratch,
+                         eager_deopt_info());
+
+  // Convert the value to a double, deopting if it's not a number.
+  Label is_smi, store;
+  __ JumpIfSmi(value, &is_smi);
+  __ CompareRoot(FieldOperand(value, HeapObject::kMapOffset),
+                 RootIndex::kHeapNumberMap);
+  EmitEagerDeoptIf(not_equal, code_gen_state, this);
+  __ Movsd(kScratchDoubleReg, FieldOperand(value, HeapNumber::kValueOffset));
+  // Canonicalize NaNs, so that we never store the hole NaN.
+  __ Ucomisd(kScratchDoubleReg, kScratchDoubleReg);
+  __ j(parity_odd, &store);
+  __ Move(kScratchDoubleReg, std::numeric_limits<double>::quiet_NaN());
+  __ jmp(&store);
+  __ bind(&is_smi);
+  __ SmiUntag(scratch, value);
+  __ Cvtlsi2sd(kScratchDoubleReg, scratch);
+  __ bind(&store);
+
+  __ DecompressTaggedPointer(scratch,
+                             FieldOperand(object, JSObject::kElementsOffset));
+  __ Movsd(FieldOperand(scratch, index, times_8, FixedDoubleArray::kHeaderSize),
+           kScratchDoubleReg);
+}
+
+void StoreTypedArrayElement::AllocateVreg(
+    MaglevVregAllocationState* vreg_state, const ProcessingState& state) {
+  UseRegister(object_input());
+  UseRegister(index_input());
+  UseRegister(value_input());
+  set_temporaries_needed(1);
+}
+void StoreTypedArrayElement::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                          const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  Register index = ToRegister(index_input());
+  Register value = ToRegister(value_input());
+  RegList temps = temporaries();
+  Register data_pointer = temps.PopFirst();
+
+  EmitTypedArrayDataPointer(code_gen_state, object, index, data_pointer,
+                            kScratchRegister, eager_deopt_info());
+  Operand element_operand(data_pointer, index,
+                          TypedArrayScaleFactor(elements_kind()), 0);
+  // Integer stores truncate the int32 value to the element size.
+  switch (elements_kind()) {
+    case INT8_ELEMENTS:
+    case UINT8_ELEMENTS:
+      __ movb(element_operand, value);
+      break;
+    case INT16_ELEMENTS:
+    case UINT16_ELEMENTS:
+      __ movw(element_operand, value);
+      break;
+    case INT32_ELEMENTS:
+    case UINT32_ELEMENTS:
+      __ movl(element_operand, value);
+      break;
+    default:
+      UNREACHABLE();
+  }
+}
+void StoreTypedArrayElement::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << ElementsKindToString(elements_kind()) << ")";
+}
+
 void LoadNamedGeneric::AllocateVreg(MaglevVregAllocationState* vreg_state,
                                     const ProcessingState& state) {
   using D = LoadWithVectorDescriptor;
@@ -623,6 +1111,71 @@ void LoadNamedGeneric::PrintParams(std::ostream& os,
   os << "(" << name_ << ")";
 }
 
+void SetNamedGeneric::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                   const ProcessingState& state) {
+  using D = StoreWithVectorDescriptor;
+  UseFixed(context(), kContextRegister);
+  UseFixed(object_input(), D::GetRegisterParameter(D::kReceiver));
+  UseFixed(value_input(), D::GetRegisterParameter(D::kValue));
+}
+void SetNamedGeneric::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                   const ProcessingState& state) {
+  using D = StoreWithVectorDescriptor;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(object_input()), D::GetRegisterParameter(D::kReceiver));
+  DCHECK_EQ(ToRegister(value_input()), D::GetRegisterParameter(D::kValue));
+  __ Move(D::GetRegisterParameter(D::kName), name().object());
+  __ Move(D::GetRegisterParameter(D::kSlot),
+          Smi::FromInt(feedback().slot.ToInt()));
+  __ Move(D::GetRegisterParameter(D::kVector), feedback().vector);
+  __ CallBuiltin(Builtin::kStoreIC);
+}
+void SetNamedGeneric::PrintParams(std::ostream& os,
+                                  MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << name_ << ")";
+}
+
+void GetKeyedGeneric::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                   const ProcessingState& state) {
+  using D = LoadWithVectorDescriptor;
+  UseFixed(context(), kContextRegister);
+  UseFixed(object_input(), D::GetRegisterParameter(D::kReceiver));
+  UseFixed(key_input(), D::GetRegisterParameter(D::kName));
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void GetKeyedGeneric::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                   const ProcessingState& state) {
+  using D = LoadWithVectorDescriptor;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(object_input()), D::GetRegisterParameter(D::kReceiver));
+  DCHECK_EQ(ToRegister(key_input()), D::GetRegisterParameter(D::kName));
+  __ Move(D::GetRegisterParameter(D::kSlot),
+          Smi::FromInt(feedback().slot.ToInt()));
+  __ Move(D::GetRegisterParameter(D::kVector), feedback().vector);
+  __ CallBuiltin(Builtin::kKeyedLoadIC);
+}
+
+void SetKeyedGeneric::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                   const ProcessingState& state) {
+  using D = StoreWithVectorDescriptor;
+  UseFixed(context(), kContextRegister);
+  UseFixed(object_input(), D::GetRegisterParameter(D::kReceiver));
+  UseFixed(key_input(), D::GetRegisterParameter(D::kName));
+  UseFixed(value_input(), D::GetRegisterParameter(D::kValue));
+}
+void SetKeyedGeneric::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                   const ProcessingState& state) {
+  using D = StoreWithVectorDescriptor;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(object_input()), D::GetRegisterParameter(D::kReceiver));
+  DCHECK_EQ(ToRegister(key_input()), D::GetRegisterParameter(D::kName));
+  DCHECK_EQ(ToRegister(value_input()), D::GetRegisterParameter(D::kValue));
+  __ Move(D::GetRegisterParameter(D::kSlot),
+          Smi::FromInt(feedback().slot.ToInt()));
+  __ Move(D::GetRegisterParameter(D::kVector), feedback().vector);
+  __ CallBuiltin(Builtin::kKeyedStoreIC);
+}
+
 void GapMove::AllocateVreg(MaglevVregAllocationState* vreg_state,
                            const ProcessingState& state) {
   UNREACHABLE();
@@ -726,6 +1279,13 @@ void CheckedSmiUntag::AllocateVreg(MaglevVregAllocationState* vreg_state,
 void CheckedSmiUntag::GenerateCode(MaglevCodeGenState* code_gen_state,
                                    const ProcessingState& state) {
   Register value = ToRegister(input());
+  if (input().node()->properties().value_representation() ==
+      ValueRepresentation::kInt32) {
+    // The input is a Phi that was untagged by representation selection, so
+    // the value is already an int32 and there is nothing to check.
+    DCHECK(input().node()->Is<Phi>());
+    return;
+  }
   // TODO(leszeks): Consider optimizing away this test and using the carry bit
   // of the `sarl` for cases where the deopt uses the value from a different
   // register.
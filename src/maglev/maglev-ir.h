@@ -17,9 +17,11 @@
 #include "src/compiler/heap-refs.h"
 #include "src/interpreter/bytecode-register.h"
 #include "src/maglev/maglev-compilation-unit.h"
+#include "src/objects/elements-kind.h"
 #include "src/objects/smi.h"
 #include "src/roots/roots.h"
 #include "src/utils/utils.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
 
 namespace v8 {
@@ -68,10 +70,15 @@ class CompactInterpreterFrameState;
 #define VALUE_NODE_LIST(V) \
   V(Call)                  \
   V(Constant)              \
+  V(GetKeyedGeneric)       \
   V(InitialValue)          \
+  V(LoadDoubleElement)     \
   V(LoadField)             \
   V(LoadGlobal)            \
   V(LoadNamedGeneric)      \
+  V(LoadPolymorphicField)  \
+  V(LoadTaggedElement)     \
+  V(LoadTypedArrayElement) \
   V(Phi)                   \
   V(RegisterInput)         \
   V(RootConstant)          \
@@ -82,10 +89,19 @@ class CompactInterpreterFrameState;
   V(Int32Constant)         \
   GENERIC_OPERATIONS_NODE_LIST(V)
 
-#define NODE_LIST(V) \
-  V(CheckMaps)       \
-  V(GapMove)         \
-  V(StoreField)      \
+#define NODE_LIST(V)        \
+  V(CheckMaps)              \
+  V(CheckMapsPolymorphic)   \
+  V(CheckSmi)               \
+  V(CheckValue)             \
+  V(GapMove)                \
+  V(SetKeyedGeneric)        \
+  V(SetNamedGeneric)        \
+  V(StoreDoubleElement)     \
+  V(StoreField)             \
+  V(StorePolymorphicField)  \
+  V(StoreTaggedElement)     \
+  V(StoreTypedArrayElement) \
   VALUE_NODE_LIST(V)
 
 #define CONDITIONAL_CONTROL_NODE_LIST(V) \
@@ -204,6 +220,11 @@ class OpProperties {
     return OpProperties(bitfield_ | that.bitfield_);
   }
 
+  constexpr OpProperties WithNewValueRepresentation(
+      ValueRepresentation new_repr) const {
+    return OpProperties(kValueRepresentationBits::update(bitfield_, new_repr));
+  }
+
   static constexpr OpProperties Pure() { return OpProperties(kPureValue); }
   static constexpr OpProperties Call() {
     return OpProperties(kIsCallBit::encode(true));
@@ -579,6 +600,10 @@ class NodeBase : public ZoneObject {
     new (input_address(index)) Input(input);
   }
 
+  void set_properties(OpProperties properties) {
+    bit_field_ = OpPropertiesField::update(bit_field_, properties);
+  }
+
   // For nodes that don't have data past the input, allow trimming the input
   // count. This is used by Phis to reduce inputs when merging in dead control
   // flow.
@@ -1190,6 +1215,67 @@ class CheckMaps : public FixedInputNodeT<1, CheckMaps> {
   const compiler::MapRef map_;
 };
 
+class CheckMapsPolymorphic : public FixedInputNodeT<1, CheckMapsPolymorphic> {
+  using Base = FixedInputNodeT<1, CheckMapsPolymorphic>;
+
+ public:
+  explicit CheckMapsPolymorphic(uint32_t bitfield,
+                                const ZoneVector<compiler::MapRef>& maps)
+      : Base(bitfield), maps_(maps) {}
+
+  static constexpr OpProperties kProperties = OpProperties::EagerDeopt();
+
+  const ZoneVector<compiler::MapRef>& maps() const { return maps_; }
+
+  static constexpr int kActualMapIndex = 0;
+  Input& actual_map_input() { return input(kActualMapIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const ZoneVector<compiler::MapRef> maps_;
+};
+
+class CheckSmi : public FixedInputNodeT<1, CheckSmi> {
+  using Base = FixedInputNodeT<1, CheckSmi>;
+
+ public:
+  explicit CheckSmi(uint32_t bitfield) : Base(bitfield) {}
+
+  static constexpr OpProperties kProperties = OpProperties::EagerDeopt();
+
+  static constexpr int kReceiverIndex = 0;
+  Input& receiver_input() { return input(kReceiverIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+class CheckValue : public FixedInputNodeT<1, CheckValue> {
+  using Base = FixedInputNodeT<1, CheckValue>;
+
+ public:
+  explicit CheckValue(uint32_t bitfield, const compiler::HeapObjectRef& value)
+      : Base(bitfield), value_(value) {}
+
+  static constexpr OpProperties kProperties = OpProperties::EagerDeopt();
+
+  compiler::HeapObjectRef value() const { return value_; }
+
+  static constexpr int kTargetIndex = 0;
+  Input& target_input() { return input(kTargetIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::HeapObjectRef value_;
+};
+
 class LoadField : public FixedInputValueNodeT<1, LoadField> {
   using Base = FixedInputValueNodeT<1, LoadField>;
 
@@ -1236,6 +1322,217 @@ class StoreField : public FixedInputNodeT<2, StoreField> {
   const int handler_;
 };
 
+// A single map case of a polymorphic field access, together with the Smi
+// handler that the IC uses for objects with that map.
+struct PolymorphicFieldAccess {
+  compiler::MapRef map;
+  int handler;
+};
+
+class LoadPolymorphicField
+    : public FixedInputValueNodeT<1, LoadPolymorphicField> {
+  using Base = FixedInputValueNodeT<1, LoadPolymorphicField>;
+
+ public:
+  explicit LoadPolymorphicField(
+      uint32_t bitfield, const ZoneVector<PolymorphicFieldAccess>& accesses)
+      : Base(bitfield), accesses_(accesses) {}
+
+  static constexpr OpProperties kProperties =
+      OpProperties::EagerDeopt() | OpProperties::Reading();
+
+  const ZoneVector<PolymorphicFieldAccess>& accesses() const {
+    return accesses_;
+  }
+
+  static constexpr int kObjectIndex = 0;
+  Input& object_input() { return input(kObjectIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const ZoneVector<PolymorphicFieldAccess> accesses_;
+};
+
+class StorePolymorphicField
+    : public FixedInputNodeT<2, StorePolymorphicField> {
+  using Base = FixedInputNodeT<2, StorePolymorphicField>;
+
+ public:
+  explicit StorePolymorphicField(
+      uint32_t bitfield, const ZoneVector<PolymorphicFieldAccess>& accesses)
+      : Base(bitfield), accesses_(accesses) {}
+
+  static constexpr OpProperties kProperties =
+      OpProperties::EagerDeopt() | OpProperties::Writing();
+
+  const ZoneVector<PolymorphicFieldAccess>& accesses() const {
+    return accesses_;
+  }
+
+  static constexpr int kObjectIndex = 0;
+  static constexpr int kValueIndex = 1;
+  Input& object_input() { return input(kObjectIndex); }
+  Input& value_input() { return input(kValueIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const ZoneVector<PolymorphicFieldAccess> accesses_;
+};
+
+// Element accesses only handle in-bounds accesses to the elements of packed
+// JSArrays and to typed arrays with an int32 compatible element type. The
+// receiver maps are checked separately, and the index is an int32.
+class LoadTaggedElement : public FixedInputValueNodeT<2, LoadTaggedElement> {
+  using Base = FixedInputValueNodeT<2, LoadTaggedElement>;
+
+ public:
+  explicit LoadTaggedElement(uint32_t bitfield) : Base(bitfield) {}
+
+  static constexpr OpProperties kProperties =
+      OpProperties::EagerDeopt() | OpProperties::Reading();
+
+  static constexpr int kObjectIndex = 0;
+  static constexpr int kIndexIndex = 1;
+  Input& object_input() { return input(kObjectIndex); }
+  Input& index_input() { return input(kIndexIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+class LoadDoubleElement : public FixedInputValueNodeT<2, LoadDoubleElement> {
+  using Base = FixedInputValueNodeT<2, LoadDoubleElement>;
+
+ public:
+  explicit LoadDoubleElement(uint32_t bitfield) : Base(bitfield) {}
+
+  // The loaded value is boxed in a HeapNumber allocated by a runtime call.
+  // TODO(v8:7700): Use Float64 values once Maglev supports them.
+  static constexpr OpProperties kProperties = OpProperties::EagerDeopt() |
+                                              OpProperties::Reading() |
+                                              OpProperties::Call();
+
+  static constexpr int kObjectIndex = 0;
+  static constexpr int kIndexIndex = 1;
+  Input& object_input() { return input(kObjectIndex); }
+  Input& index_input() { return input(kIndexIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+class LoadTypedArrayElement
+    : public FixedInputValueNodeT<2, LoadTypedArrayElement> {
+  using Base = FixedInputValueNodeT<2, LoadTypedArrayElement>;
+
+ public:
+  explicit LoadTypedArrayElement(uint32_t bitfield, ElementsKind elements_kind)
+      : Base(bitfield), elements_kind_(elements_kind) {}
+
+  static constexpr OpProperties kProperties = OpProperties::EagerDeopt() |
+                                              OpProperties::Reading() |
+                                              OpProperties::Int32();
+
+  ElementsKind elements_kind() const { return elements_kind_; }
+
+  static constexpr int kObjectIndex = 0;
+  static constexpr int kIndexIndex = 1;
+  Input& object_input() { return input(kObjectIndex); }
+  Input& index_input() { return input(kIndexIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const ElementsKind elements_kind_;
+};
+
+class StoreTaggedElement : public FixedInputNodeT<3, StoreTaggedElement> {
+  using Base = FixedInputNodeT<3, StoreTaggedElement>;
+
+ public:
+  explicit StoreTaggedElement(uint32_t bitfield, ElementsKind elements_kind)
+      : Base(bitfield), elements_kind_(elements_kind) {}
+
+  static constexpr OpProperties kProperties =
+      OpProperties::EagerDeopt() | OpProperties::Writing();
+
+  ElementsKind elements_kind() const { return elements_kind_; }
+
+  static constexpr int kObjectIndex = 0;
+  static constexpr int kIndexIndex = 1;
+  static constexpr int kValueIndex = 2;
+  Input& object_input() { return input(kObjectIndex); }
+  Input& index_input() { return input(kIndexIndex); }
+  Input& value_input() { return input(kValueIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const ElementsKind elements_kind_;
+};
+
+class StoreDoubleElement : public FixedInputNodeT<3, StoreDoubleElement> {
+  using Base = FixedInputNodeT<3, StoreDoubleElement>;
+
+ public:
+  explicit StoreDoubleElement(uint32_t bitfield) : Base(bitfield) {}
+
+  static constexpr OpProperties kProperties =
+      OpProperties::EagerDeopt() | OpProperties::Writing();
+
+  static constexpr int kObjectIndex = 0;
+  static constexpr int kIndexIndex = 1;
+  static constexpr int kValueIndex = 2;
+  Input& object_input() { return input(kObjectIndex); }
+  Input& index_input() { return input(kIndexIndex); }
+  Input& value_input() { return input(kValueIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+class StoreTypedArrayElement
+    : public FixedInputNodeT<3, StoreTypedArrayElement> {
+  using Base = FixedInputNodeT<3, StoreTypedArrayElement>;
+
+ public:
+  explicit StoreTypedArrayElement(uint32_t bitfield,
+                                  ElementsKind elements_kind)
+      : Base(bitfield), elements_kind_(elements_kind) {}
+
+  static constexpr OpProperties kProperties =
+      OpProperties::EagerDeopt() | OpProperties::Writing();
+
+  ElementsKind elements_kind() const { return elements_kind_; }
+
+  static constexpr int kObjectIndex = 0;
+  static constexpr int kIndexIndex = 1;
+  static constexpr int kValueIndex = 2;
+  Input& object_input() { return input(kObjectIndex); }
+  Input& index_input() { return input(kIndexIndex); }
+  Input& value_input() { return input(kValueIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const ElementsKind elements_kind_;
+};
+
 class LoadGlobal : public FixedInputValueNodeT<1, LoadGlobal> {
   using Base = FixedInputValueNodeT<1, LoadGlobal>;
 
@@ -1285,6 +1582,94 @@ class LoadNamedGeneric : public FixedInputValueNodeT<2, LoadNamedGeneric> {
   const compiler::FeedbackSource feedback_;
 };
 
+class SetNamedGeneric : public FixedInputNodeT<3, SetNamedGeneric> {
+  using Base = FixedInputNodeT<3, SetNamedGeneric>;
+
+ public:
+  explicit SetNamedGeneric(uint32_t bitfield, const compiler::NameRef& name,
+                           const compiler::FeedbackSource& feedback)
+      : Base(bitfield), name_(name), feedback_(feedback) {}
+
+  // The implementation currently calls runtime.
+  static constexpr OpProperties kProperties = OpProperties::JSCall();
+
+  compiler::NameRef name() const { return name_; }
+  compiler::FeedbackSource feedback() const { return feedback_; }
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kObjectIndex = 1;
+  static constexpr int kValueIndex = 2;
+  Input& context() { return input(kContextIndex); }
+  Input& object_input() { return input(kObjectIndex); }
+  Input& value_input() { return input(kValueIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::NameRef name_;
+  const compiler::FeedbackSource feedback_;
+};
+
+class GetKeyedGeneric : public FixedInputValueNodeT<3, GetKeyedGeneric> {
+  using Base = FixedInputValueNodeT<3, GetKeyedGeneric>;
+
+ public:
+  explicit GetKeyedGeneric(uint32_t bitfield,
+                           const compiler::FeedbackSource& feedback)
+      : Base(bitfield), feedback_(feedback) {}
+
+  // The implementation currently calls runtime.
+  static constexpr OpProperties kProperties = OpProperties::JSCall();
+
+  compiler::FeedbackSource feedback() const { return feedback_; }
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kObjectIndex = 1;
+  static constexpr int kKeyIndex = 2;
+  Input& context() { return input(kContextIndex); }
+  Input& object_input() { return input(kObjectIndex); }
+  Input& key_input() { return input(kKeyIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+
+ private:
+  const compiler::FeedbackSource feedback_;
+};
+
+class SetKeyedGeneric : public FixedInputNodeT<4, SetKeyedGeneric> {
+  using Base = FixedInputNodeT<4, SetKeyedGeneric>;
+
+ public:
+  explicit SetKeyedGeneric(uint32_t bitfield,
+                           const compiler::FeedbackSource& feedback)
+      : Base(bitfield), feedback_(feedback) {}
+
+  // The implementation currently calls runtime.
+  static constexpr OpProperties kProperties = OpProperties::JSCall();
+
+  compiler::FeedbackSource feedback() const { return feedback_; }
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kObjectIndex = 1;
+  static constexpr int kKeyIndex = 2;
+  static constexpr int kValueIndex = 3;
+  Input& context() { return input(kContextIndex); }
+  Input& object_input() { return input(kObjectIndex); }
+  Input& key_input() { return input(kKeyIndex); }
+  Input& value_input() { return input(kValueIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+
+ private:
+  const compiler::FeedbackSource feedback_;
+};
+
 class GapMove : public FixedInputNodeT<0, GapMove> {
   using Base = FixedInputNodeT<0, GapMove>;
 
@@ -1321,6 +1706,15 @@ class Phi : public ValueNodeT<Phi> {
   interpreter::Register owner() const { return owner_; }
   int merge_offset() const { return merge_offset_; }
 
+  // Phis are created tagged, but may be untagged by representation selection,
+  // so read the representation from the node rather than from kProperties.
+  OpProperties properties() const { return NodeBase::properties(); }
+  void change_representation(ValueRepresentation new_repr) {
+    DCHECK_EQ(properties().value_representation(),
+              ValueRepresentation::kTagged);
+    set_properties(properties().WithNewValueRepresentation(new_repr));
+  }
+
   using Node::reduce_input_count;
   using Node::set_input;
 
@@ -0,0 +1,204 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/maglev/maglev-phi-representation-selector.h"
+
+#include "src/maglev/maglev-compilation-info.h"
+#include "src/maglev/maglev-compilation-unit.h"
+#include "src/maglev/maglev-graph-labeller.h"
+#include "src/maglev/maglev-graph-processor.h"
+#include "src/maglev/maglev-interpreter-frame-state.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+void MaglevPhiRepresentationSelector::Process(Phi* node,
+                                              const ProcessingState& state) {
+  phis_.push_back(node);
+  phi_blocks_[node] = current_block_;
+  // Loop phis whose back edge is dead have no valid loop input, and stay
+  // tagged.
+  bool has_dead_input = false;
+  for (int i = 0; i < node->input_count(); i++) {
+    if (current_block_->predecessor_at(i) == nullptr) {
+      has_dead_input = true;
+      continue;
+    }
+    RecordUse(node, &node->input(i));
+  }
+  if (!has_dead_input) selected_.insert(node);
+}
+
+void MaglevPhiRepresentationSelector::RecordDeoptUses(
+    const MaglevCompilationUnit& unit,
+    const CheckpointedInterpreterState* state) {
+  if (state->parent) {
+    RecordDeoptUses(*unit.caller(), state->parent);
+  }
+  state->register_frame->ForEachValue(
+      unit, [&](ValueNode* node, interpreter::Register reg) {
+        deopt_uses_.insert(node);
+      });
+}
+
+bool MaglevPhiRepresentationSelector::CanBeInt32(ValueNode* node) const {
+  if (node->properties().value_representation() ==
+      ValueRepresentation::kInt32) {
+    return true;
+  }
+  if (node->Is<CheckedSmiTag>() || node->Is<SmiConstant>()) return true;
+  if (Phi* phi = node->TryCast<Phi>()) return selected_.count(phi) != 0;
+  return false;
+}
+
+bool MaglevPhiRepresentationSelector::IsTaggedUse(const Use& use) const {
+  if (use.user->Is<CheckedSmiUntag>()) return false;
+  if (use.user->Is<Phi>()) {
+    return selected_.count(use.user->Cast<Phi>()) == 0;
+  }
+  return true;
+}
+
+bool MaglevPhiRepresentationSelector::HasInt32Use(Phi* phi) const {
+  auto it = uses_.find(phi);
+  if (it == uses_.end()) return false;
+  for (const Use& use : it->second) {
+    if (!IsTaggedUse(use)) return true;
+  }
+  return false;
+}
+
+bool MaglevPhiRepresentationSelector::CanRetagAtMergePoint(Phi* phi) const {
+  auto it = uses_.find(phi);
+  if (it == uses_.end()) return true;
+  bool has_tagged_use = false;
+  for (const Use& use : it->second) {
+    if (IsTaggedUse(use)) {
+      has_tagged_use = true;
+      break;
+    }
+  }
+  if (!has_tagged_use) return true;
+
+  const MergePointInterpreterFrameState* merge_state =
+      phi_blocks_.at(phi)->state();
+  const MaglevCompilationUnit& unit = merge_state->compilation_unit();
+  // The retag is placed at the start of the Phi's block, which for a loop
+  // header runs on every iteration. Keep such loop phis tagged rather than
+  // move the per-iteration tag from the back edge to the header.
+  if (unit.bytecode_analysis().IsLoopHeader(phi->merge_offset())) {
+    return false;
+  }
+
+  // The retagging deopts to the merge point, for which we only have a frame
+  // state (and no parent state) in the outermost function.
+  if (unit.inlining_depth() > 0) return false;
+  bool has_all_values = true;
+  merge_state->frame_state().ForEachValue(
+      unit, [&](ValueNode* node, interpreter::Register reg) {
+        if (node == nullptr) has_all_values = false;
+      });
+  return has_all_values;
+}
+
+ValueNode* MaglevPhiRepresentationSelector::GetInt32Input(ValueNode* input) {
+  if (CheckedSmiTag* tag = input->TryCast<CheckedSmiTag>()) {
+    bypassed_tags_.insert(tag);
+    return tag->input().node();
+  }
+  if (SmiConstant* constant = input->TryCast<SmiConstant>()) {
+    auto it = int32_constants_.find(constant);
+    if (it != int32_constants_.end()) return it->second;
+    Int32Constant* int32_constant = Node::New<Int32Constant>(
+        compilation_info_->zone(), {}, constant->value().value());
+    Node::List::AddAfter(constant, int32_constant);
+    if (compilation_info_->has_graph_labeller()) {
+      compilation_info_->graph_labeller()->RegisterNode(int32_constant);
+    }
+    int32_constants_[constant] = int32_constant;
+    return int32_constant;
+  }
+  DCHECK_EQ(input->properties().value_representation(),
+            ValueRepresentation::kInt32);
+  return input;
+}
+
+void MaglevPhiRepresentationSelector::RetagForTaggedUses(Phi* phi) {
+  std::vector<Input*> tagged_inputs;
+  for (const Use& use : uses_[phi]) {
+    if (use.input->node() == phi && IsTaggedUse(use)) {
+      tagged_inputs.push_back(use.input);
+    }
+  }
+  if (tagged_inputs.empty()) return;
+
+  BasicBlock* block = phi_blocks_[phi];
+  MergePointInterpreterFrameState* merge_state = block->state();
+  const MaglevCompilationUnit& unit = merge_state->compilation_unit();
+  CheckpointedInterpreterState checkpoint(BytecodeOffset(phi->merge_offset()),
+                                          &merge_state->frame_state(), nullptr);
+  CheckedSmiTag* tagged =
+      Node::New<CheckedSmiTag, std::initializer_list<ValueNode*>>(
+          unit.zone(), unit, checkpoint, {phi});
+  block->nodes().AddFront(tagged);
+  if (compilation_info_->has_graph_labeller()) {
+    compilation_info_->graph_labeller()->RegisterNode(tagged);
+  }
+  RecordDeoptUses(unit, &tagged->eager_deopt_info()->state);
+
+  for (Input* input : tagged_inputs) new (input) Input(tagged);
+}
+
+void MaglevPhiRepresentationSelector::RemoveUnusedTag(CheckedSmiTag* tag) {
+  if (deopt_uses_.count(tag)) return;
+  for (const Use& use : uses_[tag]) {
+    if (use.input->node() == tag) return;
+  }
+  tag_blocks_[tag]->nodes().Remove(tag);
+}
+
+void MaglevPhiRepresentationSelector::PostProcessGraph(MaglevCompilationInfo*,
+                                                       Graph* graph) {
+  // Narrow down the candidates until all inputs of the selected Phis are
+  // int32 and each of them is worth untagging.
+  bool changed;
+  do {
+    changed = false;
+    for (Phi* phi : phis_) {
+      if (!selected_.count(phi)) continue;
+      bool can_untag = HasInt32Use(phi) && CanRetagAtMergePoint(phi);
+      for (Input& input : *phi) {
+        if (!can_untag) break;
+        can_untag = CanBeInt32(input.node());
+      }
+      if (!can_untag) {
+        selected_.erase(phi);
+        changed = true;
+      }
+    }
+  } while (changed);
+
+  if (selected_.empty()) return;
+
+  for (Phi* phi : phis_) {
+    if (!selected_.count(phi)) continue;
+    phi->change_representation(ValueRepresentation::kInt32);
+  }
+  for (Phi* phi : phis_) {
+    if (!selected_.count(phi)) continue;
+    for (int i = 0; i < phi->input_count(); i++) {
+      phi->set_input(i, GetInt32Input(phi->input(i).node()));
+    }
+  }
+  for (Phi* phi : phis_) {
+    if (!selected_.count(phi)) continue;
+    RetagForTaggedUses(phi);
+  }
+  for (CheckedSmiTag* tag : bypassed_tags_) RemoveUnusedTag(tag);
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
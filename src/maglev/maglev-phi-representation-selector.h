@@ -0,0 +1,112 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_MAGLEV_MAGLEV_PHI_REPRESENTATION_SELECTOR_H_
+#define V8_MAGLEV_MAGLEV_PHI_REPRESENTATION_SELECTOR_H_
+
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "src/maglev/maglev-basic-block.h"
+#include "src/maglev/maglev-graph.h"
+#include "src/maglev/maglev-ir.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+class MaglevCompilationInfo;
+class ProcessingState;
+
+// Untags Phis whose inputs are all known to be int32 values, so that loop
+// carried Smi arithmetic doesn't retag and re-check its value on every
+// iteration.
+//
+// The graph builder creates all Phis as tagged, and untagged inputs get a
+// CheckedSmiTag before being merged. This processor collects the Phis and
+// their uses while walking the graph, and in PostProcessGraph:
+//
+//   * selects the Phis whose inputs are all int32 (untagged nodes, Smi
+//     constants, CheckedSmiTags or other selected Phis) and which have at
+//     least one int32 use,
+//   * switches them to the Int32 representation and bypasses the
+//     CheckedSmiTags on their inputs, removing the ones that became unused,
+//   * retags the Phi once at the start of its block for any remaining tagged
+//     uses, deopting to the merge point if the value doesn't fit in a Smi.
+//     Loop phis with tagged uses stay tagged, since their retag would run on
+//     every iteration.
+//
+// CheckedSmiUntag uses of an untagged Phi become no-ops.
+//
+// TODO(v8:7700): Support Float64 Phis once Maglev has Float64 arithmetic.
+class MaglevPhiRepresentationSelector {
+ public:
+  void PreProcessGraph(MaglevCompilationInfo* compilation_info, Graph* graph) {
+    compilation_info_ = compilation_info;
+  }
+  void PostProcessGraph(MaglevCompilationInfo*, Graph* graph);
+  void PreProcessBasicBlock(MaglevCompilationInfo*, BasicBlock* block) {
+    current_block_ = block;
+  }
+
+  void Process(Phi* node, const ProcessingState& state);
+
+  template <typename NodeT>
+  void Process(NodeT* node, const ProcessingState& state) {
+    if constexpr (NodeT::kProperties.can_eager_deopt()) {
+      RecordDeoptUses(node->eager_deopt_info()->unit,
+                      &node->eager_deopt_info()->state);
+    }
+    if constexpr (NodeT::kProperties.can_lazy_deopt()) {
+      RecordDeoptUses(node->lazy_deopt_info()->unit,
+                      &node->lazy_deopt_info()->state);
+    }
+    for (Input& input : *node) RecordUse(node, &input);
+    if constexpr (std::is_same_v<NodeT, CheckedSmiTag>) {
+      tag_blocks_[node] = current_block_;
+    }
+  }
+
+ private:
+  struct Use {
+    NodeBase* user;
+    Input* input;
+  };
+
+  void RecordUse(NodeBase* user, Input* input) {
+    uses_[input->node()].push_back({user, input});
+  }
+  void RecordDeoptUses(const MaglevCompilationUnit& unit,
+                       const CheckpointedInterpreterState* state);
+
+  bool CanBeInt32(ValueNode* node) const;
+  bool HasInt32Use(Phi* phi) const;
+  bool CanRetagAtMergePoint(Phi* phi) const;
+  bool IsTaggedUse(const Use& use) const;
+
+  ValueNode* GetInt32Input(ValueNode* input);
+  void RetagForTaggedUses(Phi* phi);
+  void RemoveUnusedTag(CheckedSmiTag* tag);
+
+  MaglevCompilationInfo* compilation_info_ = nullptr;
+  BasicBlock* current_block_ = nullptr;
+
+  std::vector<Phi*> phis_;
+  std::unordered_map<Phi*, BasicBlock*> phi_blocks_;
+  std::unordered_map<CheckedSmiTag*, BasicBlock*> tag_blocks_;
+  std::unordered_map<ValueNode*, std::vector<Use>> uses_;
+  std::unordered_set<ValueNode*> deopt_uses_;
+
+  std::unordered_set<Phi*> selected_;
+  std::unordered_map<SmiConstant*, Int32Constant*> int32_constants_;
+  std::unordered_set<CheckedSmiTag*> bypassed_tags_;
+};
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_MAGLEV_MAGLEV_PHI_REPRESENTATION_SELECTOR_H_
@@ -322,10 +322,11 @@ void StraightForwardRegisterAllocator::UpdateUse(
   // If a value is dead, make sure it's cleared.
   FreeRegisters(node);
 
-  // If the stack slot is a local slot, free it so it can be reused.
+  // If the stack slot is a local slot, free it so it can be reused. Local
+  // slots start at index 0, fixed slots (e.g. parameters) are negative.
   if (node->is_spilled()) {
     compiler::AllocatedOperand slot = node->spill_slot();
-    if (slot.index() > 0) {
+    if (slot.index() >= 0) {
       SpillSlots& slots =
           slot.representation() == MachineRepresentation::kTagged ? tagged_
                                                                   : untagged_;
@@ -349,6 +350,10 @@ void StraightForwardRegisterAllocator::UpdateUse(
   const CompactInterpreterFrameState* checkpoint_state =
       deopt_info.state.register_frame;
   int index = 0;
+  if (deopt_info.state.parent) {
+    UpdateUse(*deopt_info.unit.caller(), deopt_info.state.parent,
+              deopt_info.input_locations, index);
+  }
   checkpoint_state->ForEachValue(
       deopt_info.unit, [&](ValueNode* node, interpreter::Register reg) {
         // Skip over the result location.
@@ -690,21 +695,24 @@ void StraightForwardRegisterAllocator::AllocateSpillSlot(ValueNode* node) {
   MachineRepresentation representation = is_tagged
                                              ? MachineRepresentation::kTagged
                                              : MachineRepresentation::kWord64;
-  if (slots.free_slots.empty()) {
-    free_slot = slots.top++;
+  // A freed slot can be reused if the value that used it died before the
+  // current node's live range starts. Since the free slots are sorted by
+  // the position they were freed at, find the first slot freed too late to be
+  // reused, and pick the latest freed slot before it. This keeps the slots
+  // that were freed earliest available for nodes with earlier live ranges.
+  NodeIdT start = node->live_range().start;
+  auto it = std::lower_bound(
+      slots.free_slots.begin(), slots.free_slots.end(), start,
+      [](const SpillSlotInfo& slot_info, NodeIdT s) {
+        return slot_info.freed_at_position < s;
+      });
+  if (it != slots.free_slots.begin()) {
+    --it;
+    DCHECK_LT(it->freed_at_position, start);
+    free_slot = it->slot_index;
+    slots.free_slots.erase(it);
   } else {
-    NodeIdT start = node->live_range().start;
-    auto it =
-        std::upper_bound(slots.free_slots.begin(), slots.free_slots.end(),
-                         start, [](NodeIdT s, const SpillSlotInfo& slot_info) {
-                           return slot_info.freed_at_position < s;
-                         });
-    if (it != slots.free_slots.end()) {
-      free_slot = it->slot_index;
-      slots.free_slots.erase(it);
-    } else {
-      free_slot = slots.top++;
-    }
+    free_slot = slots.top++;
   }
   node->Spill(compiler::AllocatedOperand(compiler::AllocatedOperand::STACK_SLOT,
                                          representation, free_slot));
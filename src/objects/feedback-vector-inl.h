@@ -181,6 +181,21 @@ void FeedbackVector::set_maybe_has_optimized_code(bool value) {
   set_flags(MaybeHasOptimizedCodeBit::update(flags(), value));
 }
 
+bool FeedbackVector::deoptimized_since_optimization() const {
+  return DeoptimizedSinceOptimizationBit::decode(flags());
+}
+
+void FeedbackVector::set_deoptimized_since_optimization(bool value) {
+  set_flags(DeoptimizedSinceOptimizationBit::update(flags(), value));
+}
+
+void FeedbackVector::clear_padding() {
+  if (FIELD_SIZE(kOptionalPaddingOffset) == 0) return;
+  DCHECK_EQ(4, FIELD_SIZE(kOptionalPaddingOffset));
+  memset(reinterpret_cast<void*>(address() + kOptionalPaddingOffset), 0,
+         FIELD_SIZE(kOptionalPaddingOffset));
+}
+
 base::Optional<CodeT> FeedbackVector::GetOptimizedOsrCode(Isolate* isolate,
                                                           FeedbackSlot slot) {
   MaybeObject maybe_code = Get(isolate, slot);
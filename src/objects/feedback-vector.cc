@@ -7,6 +7,7 @@
 #include "src/common/globals.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/diagnostics/code-tracer.h"
+#include "src/execution/tiering-profile.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
 #include "src/ic/handler-configuration-inl.h"
@@ -328,6 +329,9 @@ Handle<FeedbackVector> FeedbackVector::New(
       isolate->is_collecting_type_profile()) {
     AddToVectorsForProfilingTools(isolate, result);
   }
+  if (V8_UNLIKELY(isolate->tiering_profile() != nullptr)) {
+    isolate->tiering_profile()->Apply(*result);
+  }
   return result;
 }
 
@@ -385,6 +389,11 @@ void FeedbackVector::SaturatingIncrementProfilerTicks() {
   if (ticks < Smi::kMaxValue) set_profiler_ticks(ticks + 1);
 }
 
+void FeedbackVector::SaturatingIncrementDeoptCount() {
+  int count = deopt_count();
+  if (count < kMaxUInt8) set_deopt_count(count + 1);
+}
+
 void FeedbackVector::SetOptimizedCode(Handle<CodeT> code) {
   DCHECK(CodeKindIsOptimizedJSFunction(code->kind()));
   // We should set optimized code only when there is no valid optimized code.
@@ -432,7 +441,8 @@ void FeedbackVector::reset_flags() {
   set_flags(TieringStateBits::encode(TieringState::kNone) |
             MaybeHasOptimizedCodeBit::encode(false) |
             OsrTieringStateBit::encode(TieringState::kNone) |
-            MaybeHasOptimizedOsrCodeBit::encode(false));
+            MaybeHasOptimizedOsrCodeBit::encode(false) |
+            DeoptimizedSinceOptimizationBit::encode(false));
 }
 
 TieringState FeedbackVector::osr_tiering_state() {
@@ -678,6 +688,34 @@ bool FeedbackNexus::ConfigureMegamorphic(IcCheckType property_type) {
   return update_required;
 }
 
+bool FeedbackNexus::ConfigureGeneric() {
+  DisallowGarbageCollection no_gc;
+  switch (kind()) {
+    case FeedbackSlotKind::kBinaryOp: {
+      MaybeObject any =
+          MaybeObject::FromSmi(Smi::FromInt(BinaryOperationFeedback::kAny));
+      if (GetFeedback() == any) return false;
+      SetFeedback(any, SKIP_WRITE_BARRIER);
+      return true;
+    }
+    case FeedbackSlotKind::kCompareOp: {
+      MaybeObject any =
+          MaybeObject::FromSmi(Smi::FromInt(CompareOperationFeedback::kAny));
+      if (GetFeedback() == any) return false;
+      SetFeedback(any, SKIP_WRITE_BARRIER);
+      return true;
+    }
+    case FeedbackSlotKind::kCall:
+      if (GetSpeculationMode() == SpeculationMode::kDisallowSpeculation) {
+        return false;
+      }
+      SetSpeculationMode(SpeculationMode::kDisallowSpeculation);
+      return true;
+    default:
+      return false;
+  }
+}
+
 Map FeedbackNexus::GetFirstMap() const {
   FeedbackIterator it(this);
   if (!it.done()) {
@@ -764,9 +802,12 @@ InlineCacheState FeedbackNexus::ic_state() const {
           CHECK(heap_object.IsJSFunction() || heap_object.IsJSBoundFunction());
         }
         return InlineCacheState::MONOMORPHIC;
-      } else if (feedback->GetHeapObjectIfStrong(&heap_object) &&
-                 heap_object.IsAllocationSite()) {
-        return InlineCacheState::MONOMORPHIC;
+      } else if (feedback->GetHeapObjectIfStrong(&heap_object)) {
+        if (heap_object.IsAllocationSite()) {
+          return InlineCacheState::MONOMORPHIC;
+        }
+        // The call target profile of a megamorphic call site.
+        if (heap_object.IsWeakFixedArray()) return InlineCacheState::GENERIC;
       }
 
       CHECK_EQ(feedback, UninitializedSentinel());
@@ -1001,6 +1042,43 @@ CallFeedbackContent FeedbackNexus::GetCallFeedbackContent() {
   return CallFeedbackContentField::decode(value);
 }
 
+void FeedbackNexus::ConfigureMegamorphicCall(Handle<Object> target) {
+  DCHECK_EQ(FeedbackSlotKind::kCall, kind());
+  Isolate* isolate = GetIsolate();
+  if (!FLAG_megamorphic_inlining) {
+    // Keep the call count in the extra feedback.
+    SetFeedback(MegamorphicSentinel(), SKIP_WRITE_BARRIER);
+    return;
+  }
+
+  Handle<WeakFixedArray> profile =
+      isolate->factory()->NewWeakFixedArray(kCallTargetProfileLength);
+  for (int i = 0; i < kCallTargetProfileLength;
+       i += kCallTargetProfileEntrySize) {
+    profile->Set(i, HeapObjectReference::ClearedValue(isolate));
+    profile->Set(i + 1, MaybeObject::FromSmi(Smi::zero()));
+  }
+  DisallowGarbageCollection no_gc;
+  int index = 0;
+  // All calls but this one went to the monomorphic target so far.
+  HeapObject previous;
+  if (GetCallFeedbackContent() == CallFeedbackContent::kTarget &&
+      GetFeedback()->GetHeapObjectIfWeak(&previous) &&
+      previous.IsJSFunction()) {
+    profile->Set(index, HeapObjectReference::Weak(previous));
+    profile->Set(index + 1, MaybeObject::FromSmi(Smi::FromInt(
+                                std::max(1, GetCallCount() - 1))));
+    index += kCallTargetProfileEntrySize;
+  }
+  if (target->IsJSFunction() &&
+      JSFunction::cast(*target).native_context() ==
+          isolate->raw_native_context()) {
+    profile->Set(index, HeapObjectReference::Weak(HeapObject::cast(*target)));
+    profile->Set(index + 1, MaybeObject::FromSmi(Smi::FromInt(1)));
+  }
+  SetFeedback(*profile);
+}
+
 float FeedbackNexus::ComputeCallFrequency() {
   DCHECK(IsCallICKind(kind()));
 
@@ -219,6 +219,18 @@ class FeedbackVector
   // Increment profiler ticks, saturating at the maximal value.
   void SaturatingIncrementProfilerTicks();
 
+  // Increment the deopt count, saturating at the maximal value.
+  void SaturatingIncrementDeoptCount();
+
+  static constexpr int kNoDeoptBytecodeOffset = -1;
+
+  // Whether optimized code for this closure deoptimized eagerly since the
+  // closure was last optimized. If it didn't, that code was stable.
+  inline bool deoptimized_since_optimization() const;
+  inline void set_deoptimized_since_optimization(bool value);
+
+  inline void clear_padding();
+
   // Forward declare the non-atomic accessors.
   using TorqueGeneratedFeedbackVector::invocation_count;
   using TorqueGeneratedFeedbackVector::set_invocation_count;
@@ -804,6 +816,11 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
   // was changed. Extra feedback is cleared if the 0 parameter version is used.
   bool ConfigureMegamorphic();
   bool ConfigureMegamorphic(IcCheckType property_type);
+  // ConfigureGeneric() stops optimizing compilers from speculating on the
+  // operation that this slot belongs to: BinaryOp and CompareOp feedback
+  // becomes 'any', and Call feedback disallows speculation. Returns true if
+  // the state of the underlying vector was changed.
+  bool ConfigureGeneric();
 
   inline MaybeObject GetFeedback() const;
   inline MaybeObject GetFeedbackExtra() const;
@@ -843,6 +860,16 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
   // count (taken from the type feedback vector).
   float ComputeCallFrequency();
 
+  // With --megamorphic-inlining, megamorphic call sites keep a profile of
+  // their most frequent targets instead of the megamorphic sentinel: a
+  // WeakFixedArray of (weak JSFunction, Smi count) entries.
+  static constexpr int kCallTargetProfileEntries = 4;
+  static constexpr int kCallTargetProfileEntrySize = 2;
+  static constexpr int kCallTargetProfileLength =
+      kCallTargetProfileEntries * kCallTargetProfileEntrySize;
+  // Transitions the Call IC to megamorphic after it saw a call to {target}.
+  void ConfigureMegamorphicCall(Handle<Object> target);
+
   using SpeculationModeField = base::BitField<SpeculationMode, 0, 1>;
   using CallFeedbackContentField = base::BitField<CallFeedbackContent, 1, 1>;
   using CallCountField = base::BitField<uint32_t, 2, 30>;
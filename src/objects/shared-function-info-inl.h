@@ -264,6 +264,9 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, maglev_compilation_failed,
                     SharedFunctionInfo::MaglevCompilationFailedBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_optimization_hint,
+                    SharedFunctionInfo::HasOptimizationHintBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -449,6 +449,11 @@ class SharedFunctionInfo
 
   DECL_BOOLEAN_ACCESSORS(maglev_compilation_failed)
 
+  // True if the function was optimized by TurboFan, either in this process or
+  // in the process that produced the code cache this function was
+  // deserialized from (see --code-cache-optimization-hints).
+  DECL_BOOLEAN_ACCESSORS(has_optimization_hint)
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
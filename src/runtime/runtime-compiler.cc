@@ -16,6 +16,7 @@
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/execution/tiering-manager.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/heap/parked-scope.h"
@@ -187,6 +188,9 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   // code object from deoptimizer.
   Handle<Code> optimized_code = deoptimizer->compiled_code();
   DeoptimizeKind type = deoptimizer->deopt_kind();
+  DeoptimizeReason reason = type == DeoptimizeKind::kEager
+                                ? deoptimizer->deopt_reason()
+                                : DeoptimizeReason::kUnknown;
 
   // TODO(turbofan): We currently need the native context to materialize
   // the arguments object, but only to get to its map.
@@ -204,6 +208,7 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   // Invalidate the underlying optimized code on eager deopts.
   if (type == DeoptimizeKind::kEager) {
     Deoptimizer::DeoptimizeFunction(*function, *optimized_code);
+    isolate->tiering_manager()->OnEagerDeopt(*function, top_frame, reason);
   }
 
   return ReadOnlyRoots(isolate).undefined_value();
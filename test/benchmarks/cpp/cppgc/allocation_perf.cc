@@ -5,6 +5,7 @@
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/garbage-collected.h"
 #include "include/cppgc/heap-consistency.h"
+#include "include/cppgc/internal/gc-info.h"
 #include "src/base/macros.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap.h"
@@ -32,6 +33,15 @@ BENCHMARK_F(Allocate, Tiny)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(TinyObject));
 }
 
+BENCHMARK_F(Allocate, GCInfoIndex)(benchmark::State& st) {
+  // Ensure the type is registered so that only the fast path is measured.
+  GCInfoTrait<TinyObject>::Index();
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(GCInfoTrait<TinyObject>::Index());
+  }
+}
+
 class LargeObject final : public GarbageCollected<LargeObject> {
  public:
   void Trace(cppgc::Visitor*) const {}
@@ -6,6 +6,7 @@
 #include "src/compiler/backend/instruction-selector-impl.h"
 #include "src/compiler/backend/instruction.h"
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -39,6 +40,8 @@ class InstructionSchedulerTester {
     CHECK(scheduler_.HasSideEffect(instr));
   }
   void CheckIsDeopt(Instruction* instr) { CHECK(instr->IsDeoptimizeCall()); }
+  // Check that the instruction left the scheduling graph.
+  void CheckScheduled(Instruction* instr) { CHECK_NULL(GetNode(instr)); }
 
   void CheckInSuccessors(Instruction* instr, Instruction* successor) {
     InstructionScheduler::ScheduleGraphNode* node = GetNode(instr);
@@ -50,6 +53,46 @@ class InstructionSchedulerTester {
              successors.end());
   }
 
+  // Check that the instruction was added to the scheduling graph and wasn't
+  // scheduled yet.
+  void CheckNotScheduled(Instruction* instr) { CHECK_NOT_NULL(GetNode(instr)); }
+
+  // Check that {first} was emitted before {second}.
+  void CheckEmittedBefore(Instruction* first, Instruction* second) {
+    const InstructionDeque& instructions = sequence_.instructions();
+    auto first_it = std::find(instructions.begin(), instructions.end(), first);
+    auto second_it =
+        std::find(instructions.begin(), instructions.end(), second);
+    CHECK_NE(first_it, instructions.end());
+    CHECK_NE(second_it, instructions.end());
+    CHECK_LT(first_it - instructions.begin(), second_it - instructions.begin());
+  }
+
+  size_t EmittedInstructionCount() { return sequence_.instructions().size(); }
+
+  // Returns the cycle that the scheduler continues at when none of the ready
+  // nodes, which become ready at {start_cycles}, can be scheduled at cycle 0.
+  int NextCycleWhenIdle(std::initializer_list<int> start_cycles) {
+    InstructionScheduler::CriticalPathFirstQueue ready_list(&scheduler_);
+    for (int start_cycle : start_cycles) {
+      InstructionScheduler::ScheduleGraphNode* node =
+          zone()->New<InstructionScheduler::ScheduleGraphNode>(
+              zone(), Instruction::New(zone(), kArchNop));
+      node->set_total_latency(0);
+      node->set_start_cycle(start_cycle);
+      ready_list.AddNode(node);
+    }
+    CHECK_NULL(ready_list.PopBestCandidate(0));
+    int cycle = ready_list.EarliestStartCycle();
+    CHECK_NULL(ready_list.PopBestCandidate(cycle - 1));
+    CHECK_NOT_NULL(ready_list.PopBestCandidate(cycle));
+    return cycle;
+  }
+
+  int GetLatency(const Instruction* instr) {
+    return InstructionScheduler::GetInstructionLatency(instr);
+  }
+
   Zone* zone() { return scope_.main_zone(); }
 
  private:
@@ -104,6 +147,115 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+TEST(SchedulingWindow) {
+  FlagScope<int> window(&FLAG_turbo_instruction_scheduling_window, 2);
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  tester.StartBlock();
+  Instruction* first_inst = Instruction::New(zone, kArchNop);
+  tester.AddInstruction(first_inst);
+  Instruction* second_inst = Instruction::New(zone, kArchNop);
+  tester.AddInstruction(second_inst);
+  Instruction* third_inst = Instruction::New(zone, kArchNop);
+  tester.AddInstruction(third_inst);
+  Instruction* ret_inst = Instruction::New(zone, kArchRet);
+  tester.AddTerminator(ret_inst);
+
+  // The first window was scheduled before the third instruction was added.
+  tester.CheckScheduled(first_inst);
+  tester.CheckScheduled(second_inst);
+  tester.CheckInSuccessors(third_inst, ret_inst);
+
+  // Schedule block.
+  tester.EndBlock();
+}
+
+TEST(SchedulingWindowLargeBlock) {
+  const int window = FLAG_turbo_instruction_scheduling_window;
+  CHECK_LT(0, window);
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  tester.StartBlock();
+  // A value defined in the first window and used in the last one.
+  InstructionOperand def_output =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+  Instruction* def_inst =
+      Instruction::New(zone, kArchNop, 1, &def_output, 0, nullptr, 0, nullptr);
+  tester.AddInstruction(def_inst);
+  for (int i = 1; i < window; ++i) {
+    tester.AddInstruction(Instruction::New(zone, kArchNop));
+  }
+  // A block that fits into a single window is scheduled as a whole.
+  tester.CheckNotScheduled(def_inst);
+
+  for (int i = 0; i < 2 * window; ++i) {
+    tester.AddInstruction(Instruction::New(zone, kArchNop));
+  }
+  tester.CheckScheduled(def_inst);
+  InstructionOperand use_input =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+  Instruction* use_inst =
+      Instruction::New(zone, kArchNop, 0, nullptr, 1, &use_input, 0, nullptr);
+  tester.AddInstruction(use_inst);
+  Instruction* ret_inst = Instruction::New(zone, kArchRet);
+  tester.AddTerminator(ret_inst);
+  tester.EndBlock();
+
+  // Every instruction is emitted exactly once, and no instruction moves
+  // across the end of a window.
+  CHECK_EQ(static_cast<size_t>(3 * window + 2),
+           tester.EmittedInstructionCount());
+  tester.CheckEmittedBefore(def_inst, use_inst);
+  tester.CheckEmittedBefore(use_inst, ret_inst);
+}
+
+TEST(SkipIdleCycles) {
+  InstructionSchedulerTester tester;
+  // When no ready instruction can start yet, the scheduler continues at the
+  // first cycle that one of them can start at.
+  CHECK_EQ(7, tester.NextCycleWhenIdle({12, 7, 30}));
+  CHECK_EQ(50, tester.NextCycleWhenIdle({50}));
+}
+
+#if V8_TARGET_ARCH_X64
+TEST(LoadLatency) {
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  InstructionOperand output =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+  InstructionOperand inputs[] = {
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1),
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 2)};
+  InstructionCode memory_mode = AddressingModeField::encode(kMode_MR);
+
+  Instruction* mov_reg =
+      Instruction::New(zone, kX64Movl, 1, &output, 1, inputs, 0, nullptr);
+  Instruction* mov_load = Instruction::New(zone, kX64Movl | memory_mode, 1,
+                                           &output, 1, inputs, 0, nullptr);
+  Instruction* mov_store = Instruction::New(zone, kX64Movl | memory_mode, 0,
+                                            nullptr, 2, inputs, 0, nullptr);
+  Instruction* lea = Instruction::New(zone, kX64Lea | memory_mode, 1, &output,
+                                      1, inputs, 0, nullptr);
+  Instruction* imul_reg =
+      Instruction::New(zone, kX64Imul32, 1, &output, 2, inputs, 0, nullptr);
+  Instruction* imul_load = Instruction::New(zone, kX64Imul32 | memory_mode, 1,
+                                            &output, 2, inputs, 0, nullptr);
+
+  // Instructions that load an operand from memory wait for the load.
+  const int load_latency =
+      tester.GetLatency(mov_load) - tester.GetLatency(mov_reg);
+  CHECK_LT(0, load_latency);
+  CHECK_EQ(tester.GetLatency(imul_reg) + load_latency,
+           tester.GetLatency(imul_load));
+  // Stores and address computations don't.
+  CHECK_EQ(tester.GetLatency(mov_reg), tester.GetLatency(mov_store));
+  CHECK_EQ(tester.GetLatency(mov_reg), tester.GetLatency(lea));
+}
+#endif  // V8_TARGET_ARCH_X64
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/codegen/assembler-inl.h"
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
@@ -12,6 +13,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -496,6 +498,71 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithRememberedSetEntries) {
   heap->RemoveNearHeapLimitCallback(reset_oom, 0u);
 }
 
+namespace {
+
+Handle<Code> NewCodeObject(Isolate* isolate, int body_size) {
+  Assembler assm(AssemblerOptions{});
+  while (assm.pc_offset() < body_size) assm.nop();
+  CodeDesc desc;
+  assm.GetCode(isolate, &desc);
+  return Factory::CodeBuilder(isolate, desc, CodeKind::FOR_TESTING).Build();
+}
+
+}  // namespace
+
+TEST(AggressiveCodeSpaceCompaction) {
+  if (!FLAG_compact || !FLAG_compact_code_space ||
+      !FLAG_compact_code_space_with_stack || FLAG_stress_compaction ||
+      FLAG_stress_compaction_random || FLAG_compact_on_every_full_gc) {
+    return;
+  }
+  // A code page that is two thirds free stays below the default 70% target
+  // fragmentation but is evacuated with --aggressive-code-space-compaction.
+  FLAG_stress_concurrent_allocation = false;  // For SimulateFullSpace.
+  FlagScope<bool> aggressive_scope(&FLAG_aggressive_code_space_compaction,
+                                   true);
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  // Start on a fresh code page.
+  heap::SimulateFullSpace(heap->code_space());
+
+  const int kCodeBodySize = 4 * KB;
+  std::vector<Handle<Code>> live;
+  Page* first_page = nullptr;
+  {
+    HandleScope temporary_scope(isolate);
+    std::vector<Page*> pages;
+    for (int i = 0; pages.size() < 3; i++) {
+      Handle<Code> code = NewCodeObject(isolate, kCodeBodySize);
+      Page* page = Page::FromHeapObject(*code);
+      if (pages.empty() || pages.back() != page) pages.push_back(page);
+      // Keep every third code object alive.
+      if (i % 3 == 0) live.push_back(code);
+    }
+    first_page = pages.front();
+  }
+  // The page owning the linear allocation area is never evacuated.
+  heap::SimulateFullSpace(heap->code_space());
+
+  int live_on_first_page = 0;
+  for (Handle<Code> code : live) {
+    if (Page::FromHeapObject(*code) == first_page) live_on_first_page++;
+  }
+  CHECK_LT(0, live_on_first_page);
+
+  // The first GC frees the unreachable code objects and accounts the live
+  // bytes of the fragmented pages, the second one evacuates them.
+  CcTest::CollectAllGarbage();
+  CcTest::CollectAllGarbage();
+  for (Handle<Code> code : live) {
+    CHECK_NE(first_page, Page::FromHeapObject(*code));
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
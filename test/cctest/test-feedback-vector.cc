@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <sstream>
+
 #include "src/init/v8.h"
 #include "test/cctest/cctest.h"
 
@@ -9,11 +11,13 @@
 #include "src/codegen/macro-assembler.h"
 #include "src/debug/debug.h"
 #include "src/execution/execution.h"
+#include "src/execution/tiering-profile.h"
 #include "src/handles/global-handles.h"
 #include "src/heap/factory.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/objects-inl.h"
 #include "test/cctest/test-feedback-vector.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -356,6 +360,53 @@ TEST(VectorCallCounts) {
   CHECK_EQ(4, nexus.GetCallCount());
 }
 
+TEST(VectorCallTargetProfileSaturation) {
+  if (!i::FLAG_use_ic) return;
+  if (i::FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+  FlagScope<bool> megamorphic_inlining(&FLAG_megamorphic_inlining, true);
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  CompileRun(
+      "function a() {} function b() {} function c() {} function d() {}"
+      "function e() {}"
+      "%EnsureFeedbackVectorForFunction(f);"
+      "function f(x) { x(); } f(a); f(b);");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<FeedbackVector> feedback_vector =
+      Handle<FeedbackVector>(f->feedback_vector(), isolate);
+  FeedbackSlot slot(0);
+  FeedbackNexus nexus(feedback_vector, slot);
+  CHECK_EQ(InlineCacheState::GENERIC, nexus.ic_state());
+
+  // Fill the profile with saturated entries.
+  HeapObject profile_object;
+  CHECK(nexus.GetFeedback()->GetHeapObjectIfStrong(&profile_object));
+  Handle<WeakFixedArray> profile(WeakFixedArray::cast(profile_object),
+                                 isolate);
+  const char* names[] = {"a", "b", "c", "d"};
+  for (int i = 0; i < FeedbackNexus::kCallTargetProfileEntries; ++i) {
+    int index = i * FeedbackNexus::kCallTargetProfileEntrySize;
+    profile->Set(index, HeapObjectReference::Weak(*GetFunction(names[i])));
+    profile->Set(index + 1,
+                 MaybeObject::FromSmi(Smi::FromInt(Smi::kMaxValue)));
+  }
+
+  // Hits and replacements both keep the counts in the Smi range.
+  CompileRun("f(b); f(e);");
+  Handle<JSFunction> b = GetFunction("b");
+  Handle<JSFunction> e = GetFunction("e");
+  CHECK(profile->Get(0)->IsWeak());
+  CHECK_EQ(*e, profile->Get(0)->GetHeapObjectAssumeWeak());
+  CHECK_EQ(Smi::kMaxValue, Smi::ToInt(profile->Get(1).ToSmi()));
+  CHECK_EQ(*b, profile->Get(2)->GetHeapObjectAssumeWeak());
+  CHECK_EQ(Smi::kMaxValue, Smi::ToInt(profile->Get(3).ToSmi()));
+}
+
 TEST(VectorConstructCounts) {
   if (!i::FLAG_use_ic) return;
   if (i::FLAG_always_opt) return;
@@ -820,6 +871,56 @@ TEST(DefineNamedOwnIC) {
   CHECK_EQ(InlineCacheState::MONOMORPHIC, nexus.ic_state());
 }
 
+TEST(TieringProfileRoundTrip) {
+  FLAG_SCOPE(allow_natives_syntax);
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  CompileRun(
+      "function hot(x) { return x + 1; }"
+      "function cold(x) { return x - 1; }"
+      "%EnsureFeedbackVectorForFunction(hot);"
+      "%EnsureFeedbackVectorForFunction(cold);");
+  Handle<JSFunction> hot = GetFunction("hot");
+  Handle<JSFunction> cold = GetFunction("cold");
+  CHECK(!hot->shared().has_optimization_hint());
+  CHECK(!cold->shared().has_optimization_hint());
+
+  // Record {hot} as optimized, as if TurboFan had compiled it. The profile is
+  // written to memory rather than a file, so that concurrently running tests
+  // don't share it.
+  std::stringstream stream;
+  {
+    TieringProfile written(isolate);
+    written.RecordOptimized(hot->shared());
+    written.Write(stream);
+  }
+
+  // Only {hot} is hinted after applying the written profile.
+  TieringProfile profile(isolate);
+  CHECK(profile.Load(stream));
+  profile.Apply(hot->feedback_vector());
+  profile.Apply(cold->feedback_vector());
+  CHECK(hot->shared().has_optimization_hint());
+  CHECK(!cold->shared().has_optimization_hint());
+
+  // Streams without the profile header are rejected.
+  std::stringstream garbage("1 2\n");
+  CHECK(!TieringProfile(isolate).Load(garbage));
+}
+
+TEST(TieringProfileOutputFileName) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  FlagScope<const char*> output(&FLAG_tiering_profile_output, "profile.txt");
+  std::string expected = "profile.txt";
+  if (isolate->id() != 0) expected += "." + std::to_string(isolate->id());
+  CHECK_EQ(expected, TieringProfile(isolate).OutputFileName());
+}
+
 }  // namespace
 
 }  // namespace internal
@@ -2690,6 +2690,72 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerOptimizationHints) {
+  // Optimizing everything would also put the hint on functions that aren't
+  // explicitly optimized by this test.
+  if (!FLAG_opt || FLAG_jitless || FLAG_always_opt) return;
+  bool prev_allow_natives_syntax = FLAG_allow_natives_syntax;
+  bool prev_optimization_hints = FLAG_code_cache_optimization_hints;
+  FLAG_allow_natives_syntax = true;
+  FLAG_code_cache_optimization_hints = true;
+  FlagList::EnforceFlagImplications();
+  const char* js_source =
+      "function f() { return 'abc'; };"
+      "function g() { return 'xyz'; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f();"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f() + g().substring(3) + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Only the function that was optimized carries the hint.
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    Handle<Script> script_obj(Script::cast(toplevel->script()), i_isolate2);
+    bool found_f = false;
+    bool found_g = false;
+    SharedFunctionInfo::ScriptIterator iter(i_isolate2, *script_obj);
+    for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      std::unique_ptr<char[]> name = info.DebugNameCStr();
+      if (strcmp(name.get(), "f") == 0) {
+        CHECK(info.has_optimization_hint());
+        found_f = true;
+      } else {
+        CHECK(!info.has_optimization_hint());
+        if (strcmp(name.get(), "g") == 0) found_g = true;
+      }
+    }
+    CHECK(found_f);
+    CHECK(found_g);
+  }
+  isolate2->Dispose();
+
+  // Restore the flags.
+  FLAG_allow_natives_syntax = prev_allow_natives_syntax;
+  FLAG_code_cache_optimization_hints = prev_optimization_hints;
+  FlagList::EnforceFlagImplications();
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
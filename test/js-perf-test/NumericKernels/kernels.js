@@ -0,0 +1,154 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Small numeric loops whose throughput depends on how well independent
+// arithmetic is interleaved with long-latency multiplications, divisions and
+// loads, i.e. on instruction scheduling.
+
+new BenchmarkSuite('MatrixMultiply', [1000], [
+  new Benchmark('MatrixMultiply', false, false, 0, MatrixMultiply,
+                MatrixMultiplySetup),
+]);
+
+new BenchmarkSuite('DotProduct', [1000], [
+  new Benchmark('DotProduct', false, false, 0, DotProduct, DotProductSetup),
+]);
+
+new BenchmarkSuite('Polynomial', [1000], [
+  new Benchmark('Polynomial', false, false, 0, Polynomial),
+]);
+
+new BenchmarkSuite('Mandelbrot', [1000], [
+  new Benchmark('Mandelbrot', false, false, 0, Mandelbrot),
+]);
+
+new BenchmarkSuite('IntegerHash', [1000], [
+  new Benchmark('IntegerHash', false, false, 0, IntegerHash,
+                IntegerHashSetup),
+]);
+
+new BenchmarkSuite('NormalizeVectors', [1000], [
+  new Benchmark('NormalizeVectors', false, false, 0, NormalizeVectors,
+                NormalizeVectorsSetup),
+]);
+
+const N = 32;
+let a, b, c;
+
+function MatrixMultiplySetup() {
+  a = new Float64Array(N * N);
+  b = new Float64Array(N * N);
+  c = new Float64Array(N * N);
+  for (let i = 0; i < N * N; i++) {
+    a[i] = i % 7 - 3;
+    b[i] = i % 5 + 0.5;
+  }
+}
+
+function MatrixMultiply() {
+  for (let i = 0; i < N; i++) {
+    for (let j = 0; j < N; j++) {
+      let sum = 0;
+      for (let k = 0; k < N; k++) {
+        sum += a[i * N + k] * b[k * N + j];
+      }
+      c[i * N + j] = sum;
+    }
+  }
+  return c;
+}
+
+const kVectorLength = 4096;
+let x, y;
+
+function DotProductSetup() {
+  x = new Float64Array(kVectorLength);
+  y = new Float64Array(kVectorLength);
+  for (let i = 0; i < kVectorLength; i++) {
+    x[i] = Math.sin(i);
+    y[i] = Math.cos(i);
+  }
+}
+
+function DotProduct() {
+  // Four independent accumulators leave room to overlap the additions.
+  let s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  for (let i = 0; i < kVectorLength; i += 4) {
+    s0 += x[i] * y[i];
+    s1 += x[i + 1] * y[i + 1];
+    s2 += x[i + 2] * y[i + 2];
+    s3 += x[i + 3] * y[i + 3];
+  }
+  return s0 + s1 + s2 + s3;
+}
+
+function Polynomial() {
+  let result = 0;
+  for (let i = 0; i < 4096; i++) {
+    const t = i / 4096;
+    const t2 = t * t;
+    const t4 = t2 * t2;
+    // Estrin's scheme evaluates the pairs of coefficients independently.
+    result += (1.5 + 2.5 * t) + (3.5 + 4.5 * t) * t2 +
+        ((5.5 + 6.5 * t) + (7.5 + 8.5 * t) * t2) * t4;
+  }
+  return result;
+}
+
+function Mandelbrot() {
+  let inside = 0;
+  for (let py = 0; py < 24; py++) {
+    for (let px = 0; px < 32; px++) {
+      const cr = px / 16 - 1.5;
+      const ci = py / 12 - 1;
+      let zr = 0, zi = 0;
+      let n = 0;
+      while (n < 32 && zr * zr + zi * zi < 4) {
+        const tr = zr * zr - zi * zi + cr;
+        zi = 2 * zr * zi + ci;
+        zr = tr;
+        n++;
+      }
+      if (n == 32) inside++;
+    }
+  }
+  return inside;
+}
+
+let keys;
+
+function IntegerHashSetup() {
+  keys = new Int32Array(kVectorLength);
+  for (let i = 0; i < kVectorLength; i++) keys[i] = i * 2654435761;
+}
+
+function IntegerHash() {
+  let h0 = 0, h1 = 0;
+  for (let i = 0; i < kVectorLength; i += 2) {
+    h0 = Math.imul(h0 ^ keys[i], 0x01000193);
+    h0 ^= h0 >>> 15;
+    h1 = Math.imul(h1 ^ keys[i + 1], 0x01000193);
+    h1 ^= h1 >>> 15;
+  }
+  return h0 ^ h1;
+}
+
+const kNumVectors = 1024;
+let vectors;
+
+function NormalizeVectorsSetup() {
+  vectors = new Float64Array(3 * kNumVectors);
+  for (let i = 0; i < vectors.length; i++) vectors[i] = i % 11 + 1;
+}
+
+function NormalizeVectors() {
+  for (let i = 0; i < 3 * kNumVectors; i += 3) {
+    const vx = vectors[i], vy = vectors[i + 1], vz = vectors[i + 2];
+    const length = Math.sqrt(vx * vx + vy * vy + vz * vz);
+    vectors[i] = vx / length;
+    vectors[i + 1] = vy / length;
+    vectors[i + 2] = vz / length;
+  }
+  return vectors;
+}
@@ -0,0 +1,61 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-allocation-folding-across-merges
+// Flags: --opt --no-always-opt
+
+// Allocations of different sizes in both branches, followed by allocations
+// after the merge that are folded into the same group.
+function make(flag, x) {
+  const outer = {kind: 0, value: null};
+  let inner;
+  if (flag) {
+    inner = {a: x};
+  } else {
+    inner = {a: x, b: x + 1, c: x + 2, d: x + 3};
+  }
+  outer.value = inner;
+  const pair = [inner, {x: x}];
+  return [outer, pair];
+}
+
+function check(result, flag, x) {
+  const [outer, pair] = result;
+  assertEquals(0, outer.kind);
+  assertSame(outer.value, pair[0]);
+  assertEquals(x, pair[0].a);
+  assertEquals(x, pair[1].x);
+  if (flag) {
+    assertEquals(undefined, pair[0].b);
+  } else {
+    assertEquals(x + 3, pair[0].d);
+  }
+}
+
+%PrepareFunctionForOptimization(make);
+check(make(true, 1), true, 1);
+check(make(false, 2), false, 2);
+%OptimizeFunctionOnNextCall(make);
+for (let i = 0; i < 1000; i++) {
+  check(make(i % 2 == 0, i), i % 2 == 0, i);
+}
+assertOptimized(make);
+
+// Only one of the branches allocates.
+function maybeWrap(flag, x) {
+  let value = x;
+  if (flag) value = {wrapped: x};
+  return {value: value, next: {x: x}};
+}
+
+%PrepareFunctionForOptimization(maybeWrap);
+assertEquals(1, maybeWrap(true, 1).value.wrapped);
+assertEquals(2, maybeWrap(false, 2).value);
+%OptimizeFunctionOnNextCall(maybeWrap);
+for (let i = 0; i < 1000; i++) {
+  const result = maybeWrap(i % 3 == 0, i);
+  assertEquals(i, i % 3 == 0 ? result.value.wrapped : result.value);
+  assertEquals(i, result.next.x);
+}
+assertOptimized(maybeWrap);
@@ -0,0 +1,108 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-bounds-check-elimination
+// Flags: --opt --no-always-opt
+
+// Loops up to the length of the accessed array.
+function sum(a) {
+  let result = 0;
+  for (let i = 0; i < a.length; i++) {
+    result += a[i];
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(6, sum([1, 2, 3]));
+assertEquals(6, sum(new Int32Array([1, 2, 3])));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(10, sum([1, 2, 3, 4]));
+assertEquals(10, sum(new Int32Array([1, 2, 3, 4])));
+assertEquals(0, sum([]));
+assertOptimized(sum);
+
+// Reversed loops.
+function reverse(a) {
+  const result = [];
+  for (let i = a.length - 1; i >= 0; i--) {
+    result.push(a[i]);
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(reverse);
+assertEquals([3, 2, 1], reverse([1, 2, 3]));
+%OptimizeFunctionOnNextCall(reverse);
+assertEquals([4, 3, 2, 1], reverse([1, 2, 3, 4]));
+assertEquals([], reverse([]));
+assertOptimized(reverse);
+
+// Loops over several arrays check once that the other arrays are long enough.
+function add(dst, a, b) {
+  for (let i = 0; i < dst.length; i++) {
+    dst[i] = a[i] + b[i];
+  }
+}
+
+const dst = new Float64Array(3);
+%PrepareFunctionForOptimization(add);
+add(dst, new Float64Array([1, 2, 3]), new Float64Array([4, 5, 6]));
+assertEquals([5, 7, 9], Array.from(dst));
+%OptimizeFunctionOnNextCall(add);
+add(dst, new Float64Array([1, 1, 1]), new Float64Array([2, 2, 2]));
+assertEquals([3, 3, 3], Array.from(dst));
+assertOptimized(add);
+// A shorter array deoptimizes and leaves the elements before the end intact.
+add(dst, new Float64Array([1, 1]), new Float64Array([4, 4, 4]));
+assertEquals([5, 5, NaN], Array.from(dst));
+
+// Loops up to another limit.
+function prefixSum(a, n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) {
+    result += a[i];
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(prefixSum);
+assertEquals(3, prefixSum([1, 2, 3], 2));
+%OptimizeFunctionOnNextCall(prefixSum);
+assertEquals(6, prefixSum([1, 2, 3], 3));
+assertEquals(0, prefixSum([1, 2, 3], 0));
+assertEquals(NaN, prefixSum([1, 2, 3], 4));
+
+// Loops that don't run don't deoptimize.
+function rangeSum(a, from, to) {
+  let result = 0;
+  for (let i = from; i < to; i++) {
+    result += a[i];
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(rangeSum);
+assertEquals(5, rangeSum([1, 2, 3], 1, 3));
+%OptimizeFunctionOnNextCall(rangeSum);
+assertEquals(3, rangeSum([1, 2, 3], 0, 2));
+assertEquals(0, rangeSum([1, 2, 3], 5, 4));
+assertOptimized(rangeSum);
+
+// Loops that can be left early keep their bounds checks, so that they don't
+// deoptimize when they are left before reaching the end of the array.
+function indexOfZero(a, n) {
+  for (let i = 0; i < n; i++) {
+    if (a[i] === 0) return i;
+  }
+  return -1;
+}
+
+%PrepareFunctionForOptimization(indexOfZero);
+assertEquals(1, indexOfZero([1, 0, 2], 3));
+assertEquals(-1, indexOfZero([1, 2, 3], 3));
+%OptimizeFunctionOnNextCall(indexOfZero);
+assertEquals(1, indexOfZero([1, 0, 2], 3));
+assertEquals(1, indexOfZero([1, 0, 2], 10));
+assertOptimized(indexOfZero);
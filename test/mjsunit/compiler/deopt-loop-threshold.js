@@ -0,0 +1,171 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --deopt-loop-threshold=2
+// Flags: --opt --no-always-opt
+
+// Below the threshold, deopts only update the feedback as usual.
+function add(a, b) {
+  return a + b;
+}
+
+%PrepareFunctionForOptimization(add);
+assertEquals(3, add(1, 2));
+%OptimizeFunctionOnNextCall(add);
+assertEquals(3, add(1, 2));
+assertOptimized(add);
+assertEquals(3.5, add(1.5, 2));
+assertUnoptimized(add);
+
+%PrepareFunctionForOptimization(add);
+%OptimizeFunctionOnNextCall(add);
+assertEquals(3.5, add(1.5, 2));
+assertOptimized(add);
+// The second deopt gets the function into a deoptimization loop, and makes
+// the feedback of the addition generic.
+assertEquals('ab', add('a', 'b'));
+assertUnoptimized(add);
+
+%PrepareFunctionForOptimization(add);
+%OptimizeFunctionOnNextCall(add);
+assertEquals('ab', add('a', 'b'));
+assertEquals(3, add(1, 2));
+assertEquals('1b', add(1, 'b'));
+assertEquals(3n, add(1n, 2n));
+assertOptimized(add);
+
+// The same applies to comparisons.
+function less(a, b) {
+  return a < b;
+}
+
+%PrepareFunctionForOptimization(less);
+assertTrue(less(1, 2));
+%OptimizeFunctionOnNextCall(less);
+assertTrue(less(1, 2));
+assertTrue(less(1.5, 2));
+assertUnoptimized(less);
+
+%PrepareFunctionForOptimization(less);
+%OptimizeFunctionOnNextCall(less);
+assertTrue(less(1.5, 2));
+assertTrue(less('a', 'b'));
+assertUnoptimized(less);
+
+%PrepareFunctionForOptimization(less);
+%OptimizeFunctionOnNextCall(less);
+assertTrue(less('a', 'b'));
+assertFalse(less(2, 1));
+assertTrue(less(1n, 2n));
+assertOptimized(less);
+
+// Only deopts at the same site in a row are counted.
+function addBoth(a, b) {
+  return [a + a, b + b];
+}
+
+%PrepareFunctionForOptimization(addBoth);
+assertEquals([2, 2], addBoth(1, 1));
+%OptimizeFunctionOnNextCall(addBoth);
+assertEquals([2, 2], addBoth(1, 1));
+assertEquals([3, 2], addBoth(1.5, 1));
+assertUnoptimized(addBoth);
+
+%PrepareFunctionForOptimization(addBoth);
+%OptimizeFunctionOnNextCall(addBoth);
+assertEquals([3, 3], addBoth(1.5, 1.5));
+assertUnoptimized(addBoth);
+
+%PrepareFunctionForOptimization(addBoth);
+%OptimizeFunctionOnNextCall(addBoth);
+assertEquals(['aa', 3], addBoth('a', 1.5));
+assertUnoptimized(addBoth);
+
+// The first addition deopted once in a row, so its feedback isn't generic.
+%PrepareFunctionForOptimization(addBoth);
+%OptimizeFunctionOnNextCall(addBoth);
+assertEquals([2n, 3], addBoth(1n, 1.5));
+assertUnoptimized(addBoth);
+
+// Deopts for insufficient feedback aren't counted.
+function maybeAdd(c, a) {
+  if (c) return a + a;
+  return 0;
+}
+
+%PrepareFunctionForOptimization(maybeAdd);
+assertEquals(0, maybeAdd(false, 1));
+%OptimizeFunctionOnNextCall(maybeAdd);
+assertEquals(0, maybeAdd(false, 1));
+assertEquals(2, maybeAdd(true, 1));
+assertUnoptimized(maybeAdd);
+
+%PrepareFunctionForOptimization(maybeAdd);
+%OptimizeFunctionOnNextCall(maybeAdd);
+assertEquals(3, maybeAdd(true, 1.5));
+assertUnoptimized(maybeAdd);
+
+%PrepareFunctionForOptimization(maybeAdd);
+%OptimizeFunctionOnNextCall(maybeAdd);
+assertEquals('aa', maybeAdd(true, 'a'));
+assertUnoptimized(maybeAdd);
+
+// Optimized code that didn't deopt eagerly was stable, so the next
+// optimization starts counting from zero again.
+function addStable(a) {
+  return a + a;
+}
+
+%PrepareFunctionForOptimization(addStable);
+assertEquals(2, addStable(1));
+%OptimizeFunctionOnNextCall(addStable);
+assertEquals(2, addStable(1));
+assertEquals(3, addStable(1.5));
+assertUnoptimized(addStable);
+
+%PrepareFunctionForOptimization(addStable);
+%OptimizeFunctionOnNextCall(addStable);
+assertEquals(3, addStable(1.5));
+assertOptimized(addStable);
+%DeoptimizeFunction(addStable);
+
+%PrepareFunctionForOptimization(addStable);
+%OptimizeFunctionOnNextCall(addStable);
+assertEquals('aa', addStable('a'));
+assertUnoptimized(addStable);
+
+%PrepareFunctionForOptimization(addStable);
+%OptimizeFunctionOnNextCall(addStable);
+assertEquals(2n, addStable(1n));
+assertUnoptimized(addStable);
+
+// Deopts in inlined functions aren't counted for the outer function, as
+// their bytecode offsets refer to different bytecode.
+function addInner(a, b) {
+  return a + b;
+}
+function addOuter(a, b) {
+  return addInner(a, b);
+}
+
+%PrepareFunctionForOptimization(addInner);
+%PrepareFunctionForOptimization(addOuter);
+assertEquals(3, addOuter(1, 2));
+%OptimizeFunctionOnNextCall(addOuter);
+assertEquals(3, addOuter(1, 2));
+assertEquals(3.5, addOuter(1.5, 2));
+assertUnoptimized(addOuter);
+
+%PrepareFunctionForOptimization(addOuter);
+%OptimizeFunctionOnNextCall(addOuter);
+assertEquals(3.5, addOuter(1.5, 2));
+assertEquals(2.5, addOuter(1.5, true));
+assertUnoptimized(addOuter);
+
+// The feedback of the inlined addition wasn't made generic.
+%PrepareFunctionForOptimization(addOuter);
+%OptimizeFunctionOnNextCall(addOuter);
+assertEquals(2.5, addOuter(1.5, true));
+assertEquals('ab', addOuter('a', 'b'));
+assertUnoptimized(addOuter);
@@ -32,3 +32,43 @@
   assertEquals("first", f(0));
   assertEquals("second", f(1));
 })();
+
+// Test variable index access to array with 4 elements.
+(function testFourElementArrayVariableIndex() {
+  function f(i) {
+    const a = new Array("first", "second", "third", "fourth");
+    return a[i];
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals("first", f(0));
+  assertEquals("fourth", f(3));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals("first", f(0));
+  assertEquals("second", f(1));
+  assertEquals("third", f(2));
+  assertEquals("fourth", f(3));
+})();
+
+// Test tuples returned from inlined helpers and read in a loop.
+(function testTupleFromInlinedHelper() {
+  function minMax(x, y, z) {
+    return [Math.min(x, y, z), Math.max(x, y, z), x + y + z];
+  }
+  function f(x, y, z) {
+    const t = minMax(x, y, z);
+    let result = 0;
+    for (let i = 0; i < t.length; i++) {
+      result = result * 10 + t[i];
+    }
+    return result;
+  }
+
+  %PrepareFunctionForOptimization(minMax);
+  %PrepareFunctionForOptimization(f);
+  assertEquals(136, f(1, 2, 3));
+  assertEquals(136, f(3, 2, 1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(136, f(2, 3, 1));
+  assertEquals(147, f(2, 4, 1));
+})();
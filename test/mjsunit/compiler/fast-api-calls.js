@@ -238,3 +238,28 @@ const add_all_32bit_int_result_6args = add_all_32bit_int_result_5args +
   assertEquals(add_all_32bit_int_result_6args, result[3]);
   assertEquals(add_all_32bit_int_result_4args, result[4]);
 })();
+
+// ----------- add_optional_int32 -----------
+// `add_optional_int32` has the following signature:
+// int add_optional_int32(bool /*should_fallback*/, int32_t, Local<Value>)
+// The trailing v8::Value argument is optional.
+
+(function () {
+  function add_optional_int32() {
+    let result_without = fast_c_api.add_optional_int32(false, 42);
+    let result_with = fast_c_api.add_optional_int32(false, 42, 3);
+    return [result_without, result_with];
+  }
+
+  %PrepareFunctionForOptimization(add_optional_int32);
+  assertEquals([42, 45], add_optional_int32());
+
+  fast_c_api.reset_counts();
+  %OptimizeFunctionOnNextCall(add_optional_int32);
+  assertEquals([42, 45], add_optional_int32());
+  assertOptimized(add_optional_int32);
+
+  // The missing argument is passed as undefined on the fast path.
+  assertEquals(2, fast_c_api.fast_call_count());
+  assertEquals(0, fast_c_api.slow_call_count());
+})();
@@ -100,28 +100,54 @@ for (let i = 0; i < 100; i++) {
   ExpectSlowCall(overloaded_test, 0);
 })();
 
-// Test function with invalid overloads.
+// Test function overloads with an int32 and a JSArray argument.
 (function () {
   function overloaded_test() {
     return fast_c_api.add_all_invalid_overload(false /* should_fallback */,
       [26, -6, 42]);
   }
+  // With this overload:
+  // - add_all_int_invalid_func(Receiver, Bool, Int32, Options)
+  // - add_all_seq_c_func(Receiver, Bool, JSArray, Options)
+  // the type of the argument, an Array, rules out the int32 overload at
+  // compile time.
+  ExpectFastCall(overloaded_test, 62);
+})();
+
+//----------- Test function overloads by typed array kind. -----------
+// `add_all_overload_by_kind` has overloads for an Int32Array, a Float64Array
+// and a JSArray, which are told apart at runtime.
+
+(function () {
+  function overloaded_test(arg) {
+    return fast_c_api.add_all_overload_by_kind(false /* should_fallback */,
+      arg);
+  }
+
+  const int32_array = new Int32Array([1, 2, 3]);
+  const float64_array = new Float64Array([4, 5, 6]);
+  const js_array = [7, 8, 9];
 
   %PrepareFunctionForOptimization(overloaded_test);
-  result = overloaded_test();
-  assertEquals(62, result);
+  assertEquals(6, overloaded_test(int32_array));
+  assertEquals(15, overloaded_test(float64_array));
+  assertEquals(24, overloaded_test(js_array));
 
-  fast_c_api.reset_counts();
   %OptimizeFunctionOnNextCall(overloaded_test);
-  result = overloaded_test();
-  assertEquals(62, result);
-  // Here we deopt because with this invalid overload:
-  // - add_all_int_invalid_func(Receiver, Bool, Int32, Options)
-  // - add_all_seq_c_func(Receiver, Bool, JSArray, Options)
-  // we expect that a number will be passed as 3rd argument
-  // (SimplifiedLowering takes the type from the first overloaded function).
-  assertUnoptimized(overloaded_test);
+  fast_c_api.reset_counts();
+  assertEquals(6, overloaded_test(int32_array));
+  assertEquals(15, overloaded_test(float64_array));
+  assertEquals(24, overloaded_test(js_array));
+  assertOptimized(overloaded_test);
+  assertEquals(3, fast_c_api.fast_call_count());
+  assertEquals(0, fast_c_api.slow_call_count());
+
+  // A typed array kind without an overload takes the slow path.
+  fast_c_api.reset_counts();
+  assertEquals(6, overloaded_test(new Uint32Array([1, 2, 3])));
+  assertOptimized(overloaded_test);
   assertEquals(0, fast_c_api.fast_call_count());
+  assertEquals(1, fast_c_api.slow_call_count());
 })();
 
 // ----------- Test different TypedArray functions. -----------
@@ -0,0 +1,82 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file excercises fast API calls with string arguments and results.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --opt
+// Flags: --no-always-opt
+// Flags: --deopt-every-n-times=0
+
+const fast_c_api = new d8.test.FastCAPI();
+
+function check(func, arg, expected, fast_count, slow_count) {
+  fast_c_api.reset_counts();
+  assertEquals(expected, func(arg));
+  assertOptimized(func);
+  assertEquals(fast_count, fast_c_api.fast_call_count());
+  assertEquals(slow_count, fast_c_api.slow_call_count());
+}
+
+// ----------- copy_string -----------
+// const FastOneByteString* copy_string(bool /*should_fallback*/,
+//   const FastOneByteString&)
+
+(function TestCopyString() {
+  function copy(s) {
+    return fast_c_api.copy_string(false, s);
+  }
+  %PrepareFunctionForOptimization(copy);
+  assertEquals('hello', copy('hello'));
+  %OptimizeFunctionOnNextCall(copy);
+  copy('hello');
+
+  // Sequential one-byte strings are passed and returned on the fast path.
+  check(copy, 'hello', 'hello', 1, 0);
+  check(copy, '', '', 1, 0);
+  const flat = %FlattenString('x'.repeat(1024));
+  check(copy, flat, flat, 1, 0);
+
+  // Results that are too long are produced by the slow path.
+  const long = %FlattenString('x'.repeat(1025));
+  check(copy, long, long, 1, 1);
+
+  // Other strings and values take the slow path.
+  const cons = %ConstructConsString('abcdefghijklm', 'nopqrstuvwxyz');
+  check(copy, cons, 'abcdefghijklmnopqrstuvwxyz', 0, 1);
+  check(copy, 'ሴ', 'ሴ', 0, 1);
+  fast_c_api.reset_counts();
+  assertThrows(() => copy(42));
+  assertEquals(0, fast_c_api.fast_call_count());
+  assertEquals(1, fast_c_api.slow_call_count());
+})();
+
+(function TestCopyStringFallback() {
+  function copy_fallback(s) {
+    return fast_c_api.copy_string(true, s);
+  }
+  %PrepareFunctionForOptimization(copy_fallback);
+  assertEquals('hello', copy_fallback('hello'));
+  %OptimizeFunctionOnNextCall(copy_fallback);
+  copy_fallback('hello');
+
+  check(copy_fallback, 'hello', 'hello', 1, 1);
+})();
+
+// ----------- sum_two_byte_char_codes -----------
+// uint32_t sum_two_byte_char_codes(bool /*should_fallback*/,
+//   const FastTwoByteString&)
+
+(function TestTwoByteString() {
+  function sum(s) {
+    return fast_c_api.sum_two_byte_char_codes(false, s);
+  }
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(0x1234 + 0x61, sum('ሴa'));
+  %OptimizeFunctionOnNextCall(sum);
+  sum('ሴa');
+
+  check(sum, 'ሴa', 0x1234 + 0x61, 1, 0);
+  // One-byte strings don't match the two-byte view.
+  check(sum, 'ab', 0x61 + 0x62, 0, 1);
+})();
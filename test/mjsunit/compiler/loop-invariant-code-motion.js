@@ -0,0 +1,134 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-invariant-code-motion
+// Flags: --no-turbo-loop-peeling --opt --no-always-opt
+
+// Map checks and field loads of an object that the loop doesn't write.
+function sumScaled(config, a) {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) {
+    sum += a[i] * config.scale + config.offset;
+  }
+  return sum;
+}
+
+const config = {scale: 2, offset: 1};
+%PrepareFunctionForOptimization(sumScaled);
+assertEquals(15, sumScaled(config, [1, 2, 3]));
+%OptimizeFunctionOnNextCall(sumScaled);
+assertEquals(15, sumScaled(config, [1, 2, 3]));
+assertEquals(0, sumScaled(config, []));
+assertOptimized(sumScaled);
+// An object with a different map deoptimizes.
+assertEquals(9, sumScaled({offset: 0, scale: 3}, [1, 2]));
+assertUnoptimized(sumScaled);
+
+// Loads of fields that the loop writes stay in the loop.
+function countDown(o) {
+  let steps = 0;
+  while (o.x > 0) {
+    o.x = o.x - 1;
+    steps++;
+  }
+  return steps;
+}
+
+%PrepareFunctionForOptimization(countDown);
+assertEquals(3, countDown({x: 3}));
+%OptimizeFunctionOnNextCall(countDown);
+assertEquals(5, countDown({x: 5}));
+assertEquals(0, countDown({x: 0}));
+assertOptimized(countDown);
+
+// Map checks of objects whose map changes in the loop stay in the loop.
+function grow(o, a) {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) {
+    sum += o.x;
+    a[i] = 0.5;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(grow);
+assertEquals(2, grow({x: 1}, [1, 2]));
+assertEquals(2, grow({x: 1}, [1.5, 2.5]));
+%OptimizeFunctionOnNextCall(grow);
+const array = [1, 2, 3];
+assertEquals(6, grow({x: 2}, array));
+assertEquals([0.5, 0.5, 0.5], array);
+
+// The length of an array that the loop only reads.
+function indexOf(a, value) {
+  for (let i = 0; i < a.length; i++) {
+    if (a[i] === value) return i;
+  }
+  return -1;
+}
+
+%PrepareFunctionForOptimization(indexOf);
+assertEquals(1, indexOf([4, 5, 6], 5));
+%OptimizeFunctionOnNextCall(indexOf);
+assertEquals(2, indexOf([4, 5, 6], 6));
+assertEquals(-1, indexOf([4, 5, 6], 7));
+assertEquals(-1, indexOf([], 7));
+assertOptimized(indexOf);
+
+// Nested loops.
+function sumMatrix(m) {
+  let sum = 0;
+  for (let i = 0; i < m.rows.length; i++) {
+    const row = m.rows[i];
+    for (let j = 0; j < row.length; j++) {
+      sum += row[j] * m.factor;
+    }
+  }
+  return sum;
+}
+
+const matrix = {rows: [[1, 2], [3, 4]], factor: 10};
+%PrepareFunctionForOptimization(sumMatrix);
+assertEquals(100, sumMatrix(matrix));
+%OptimizeFunctionOnNextCall(sumMatrix);
+assertEquals(100, sumMatrix(matrix));
+assertEquals(0, sumMatrix({rows: [], factor: 10}));
+assertOptimized(sumMatrix);
+
+// A check that would fail stays in a loop that might not be entered.
+function sumAt(a, k, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += a[k];
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(sumAt);
+assertEquals(6, sumAt([1, 2, 3], 1, 3));
+%OptimizeFunctionOnNextCall(sumAt);
+assertEquals(6, sumAt([1, 2, 3], 1, 3));
+assertEquals(0, sumAt([1, 2, 3], 5, 0));
+assertOptimized(sumAt);
+
+// The body of a do-while loop is executed before the loop can be left, so
+// its checks are hoisted. They still deoptimize if they fail.
+function sumAtDoWhile(a, k, n) {
+  let sum = 0;
+  let i = 0;
+  do {
+    sum += a[k];
+    i++;
+  } while (i < n);
+  return sum;
+}
+
+%PrepareFunctionForOptimization(sumAtDoWhile);
+assertEquals(6, sumAtDoWhile([1, 2, 3], 1, 3));
+%OptimizeFunctionOnNextCall(sumAtDoWhile);
+assertEquals(6, sumAtDoWhile([1, 2, 3], 1, 3));
+assertEquals(3, sumAtDoWhile([1, 2, 3], 2, 1));
+assertOptimized(sumAtDoWhile);
+assertEquals(NaN, sumAtDoWhile([1, 2, 3], 5, 1));
+assertUnoptimized(sumAtDoWhile);
@@ -0,0 +1,72 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --megamorphic-inlining
+// Flags: --opt --no-always-opt
+
+// Inlined targets see that they run in optimized code.
+let interpreted;
+const targets = [
+  x => {
+    interpreted = %IsBeingInterpreted();
+    return x + 1;
+  },
+  x => {
+    interpreted = %IsBeingInterpreted();
+    return x * 2;
+  },
+  x => x - 3,
+  x => -x,
+  x => { throw x; },
+];
+
+function dispatch(f, x) {
+  return f(x);
+}
+
+%PrepareFunctionForOptimization(dispatch);
+// Get the call site into the megamorphic state, then call the first target
+// most of the time.
+assertEquals(2, dispatch(targets[0], 1));
+assertEquals(2, dispatch(targets[1], 1));
+assertEquals(-2, dispatch(targets[2], 1));
+assertEquals(-1, dispatch(targets[3], 1));
+for (let i = 0; i < 100; i++) {
+  assertEquals(i + 1, dispatch(targets[0], i));
+  if (i % 10 == 0) assertEquals(2 * i, dispatch(targets[1], i));
+}
+%OptimizeFunctionOnNextCall(dispatch);
+assertEquals(11, dispatch(targets[0], 10));
+assertFalse(interpreted);
+assertOptimized(dispatch);
+
+// Other targets take the generic call instead of deoptimizing.
+assertEquals(20, dispatch(targets[1], 10));
+assertTrue(interpreted);
+assertEquals(7, dispatch(targets[2], 10));
+assertEquals(-10, dispatch(targets[3], 10));
+assertThrowsEquals(() => dispatch(targets[4], 10), 10);
+assertEquals(2, dispatch(Math.abs, -2));
+assertEquals(11, dispatch(targets[0], 10));
+assertFalse(interpreted);
+assertOptimized(dispatch);
+
+// Calls that throw are caught the same way on every path.
+function tryDispatch(f, x) {
+  try {
+    return f(x);
+  } catch (e) {
+    return 'caught ' + e;
+  }
+}
+
+%PrepareFunctionForOptimization(tryDispatch);
+for (const f of targets) tryDispatch(f, 1);
+for (let i = 0; i < 100; i++) {
+  assertEquals('caught ' + i, tryDispatch(targets[4], i));
+}
+%OptimizeFunctionOnNextCall(tryDispatch);
+assertEquals('caught 1', tryDispatch(targets[4], 1));
+assertEquals(2, tryDispatch(targets[0], 1));
+assertOptimized(tryDispatch);
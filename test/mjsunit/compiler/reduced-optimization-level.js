@@ -0,0 +1,72 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-adaptive-optimization-level
+// Flags: --turbo-full-optimization-invocation-count=20
+// Flags: --no-concurrent-recompilation --no-always-opt --no-stress-opt
+
+// Only code compiled at the reduced level counts its invocations, and deopts
+// once the function reaches the invocation count for the full level. Returns
+// whether {f} stayed optimized for {count} more calls.
+function staysOptimized(f, count, ...args) {
+  for (let i = 0; i < count; i++) {
+    f(...args);
+    if (!isOptimized(f)) return false;
+  }
+  return true;
+}
+
+// Functions invoked only a few times are compiled with the reduced pipeline,
+// which must still produce correct code, and are recompiled at the full level
+// once they get hot.
+(function TestLoop() {
+  function sum(a) {
+    let result = 0;
+    for (let i = 0; i < a.length; i++) result += a[i];
+    return result;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(6, sum([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum([1, 2, 3, 4]));
+  assertOptimized(sum);
+
+  // The reduced level was used.
+  assertFalse(staysOptimized(sum, 20, [1, 2, 3]));
+  assertEquals(6, sum([1, 2, 3]));
+  assertOptimized(sum);
+
+  // The full level was used for the recompilation.
+  assertTrue(staysOptimized(sum, 40, [1, 2, 3]));
+})();
+
+(function TestNonEscapingObject() {
+  function dist(x, y) {
+    const p = {x, y};
+    return Math.sqrt(p.x * p.x + p.y * p.y);
+  }
+
+  %PrepareFunctionForOptimization(dist);
+  assertEquals(5, dist(3, 4));
+  %OptimizeFunctionOnNextCall(dist);
+  assertEquals(13, dist(5, 12));
+  assertOptimized(dist);
+  assertFalse(staysOptimized(dist, 20, 3, 4));
+})();
+
+// Functions invoked often enough are compiled with the full pipeline right
+// away.
+(function TestHotFunction() {
+  function add(a, b) {
+    return a + b;
+  }
+
+  %PrepareFunctionForOptimization(add);
+  for (let i = 0; i < 20; i++) add(i, 1);
+  %OptimizeFunctionOnNextCall(add);
+  assertEquals(3, add(1, 2));
+  assertOptimized(add);
+  assertTrue(staysOptimized(add, 40, 1, 2));
+})();
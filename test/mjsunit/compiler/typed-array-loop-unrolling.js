@@ -0,0 +1,85 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-unrolling --opt --no-always-opt
+
+// Element-wise arithmetic with trip counts that aren't a multiple of the
+// unrolling count.
+function scale(dst, src, factor, n) {
+  for (let i = 0; i < n; i++) {
+    dst[i] = src[i] * factor;
+  }
+}
+
+const src = new Float64Array([1, 2, 3, 4, 5, 6, 7]);
+const dst = new Float64Array(7);
+%PrepareFunctionForOptimization(scale);
+scale(dst, src, 2, 7);
+%OptimizeFunctionOnNextCall(scale);
+for (let n = 0; n <= 7; n++) {
+  dst.fill(0);
+  scale(dst, src, 3, n);
+  for (let i = 0; i < 7; i++) {
+    assertEquals(i < n ? src[i] * 3 : 0, dst[i]);
+  }
+}
+assertOptimized(scale);
+
+// Reductions.
+function sum(a) {
+  let result = 0;
+  for (let i = 0; i < a.length; i++) {
+    result += a[i];
+  }
+  return result;
+}
+
+const ints = new Int32Array([1, -2, 3, -4, 5]);
+%PrepareFunctionForOptimization(sum);
+assertEquals(3, sum(ints));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(3, sum(ints));
+assertEquals(0, sum(new Int32Array(0)));
+assertEquals(1, sum(new Int32Array([1])));
+assertOptimized(sum);
+
+// Byte copying, with an early exit.
+function copyUntilZero(dst, src) {
+  let i = 0;
+  for (; i < src.length; i++) {
+    if (src[i] === 0) break;
+    dst[i] = src[i];
+  }
+  return i;
+}
+
+const bytes = new Uint8Array([10, 20, 30, 0, 50]);
+const copy = new Uint8Array(5);
+%PrepareFunctionForOptimization(copyUntilZero);
+assertEquals(3, copyUntilZero(copy, bytes));
+%OptimizeFunctionOnNextCall(copyUntilZero);
+copy.fill(0);
+assertEquals(3, copyUntilZero(copy, bytes));
+assertEquals([10, 20, 30, 0, 0], Array.from(copy));
+assertEquals(2, copyUntilZero(copy, new Uint8Array([1, 2])));
+assertOptimized(copyUntilZero);
+
+// Deoptimization in a later iteration of an unrolled loop.
+function sumFloat32(a, n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) {
+    result += a[i];
+  }
+  return result;
+}
+
+const floats = new Float32Array([0.5, 1.5, 2.5, 3.5]);
+%PrepareFunctionForOptimization(sumFloat32);
+assertEquals(8, sumFloat32(floats, 4));
+%OptimizeFunctionOnNextCall(sumFloat32);
+assertEquals(8, sumFloat32(floats, 4));
+assertOptimized(sumFloat32);
+// Out of bounds reads deoptimize.
+assertEquals(NaN, sumFloat32(floats, 6));
+assertUnoptimized(sumFloat32);
@@ -0,0 +1,88 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-inlining --no-stress-opt
+
+var x = 1;
+var do_change = false;
+
+function g() {
+  if (do_change) {
+    x = 2;
+    return 40;
+  }
+  return 30;
+}
+
+function inner(y) {
+  "use strict"
+  return g() + x + y;
+}
+
+function foo(y) {
+  return 1000 + inner(y) + 10000;
+}
+
+%PrepareFunctionForOptimization(g);
+%PrepareFunctionForOptimization(inner);
+%PrepareFunctionForOptimization(foo);
+assertEquals(11131, foo(100));
+assertEquals(11131, foo(100));
+
+%OptimizeMaglevOnNextCall(foo);
+assertEquals(11231, foo(200));
+assertTrue(isMaglevved(foo));
+
+// Trigger a lazy deopt in the inlined inner function, on the next g() call.
+do_change = true;
+assertEquals(11342, foo(300));
+assertUnoptimized(foo);
+
+// Calling a different target than the inlined one deopts eagerly.
+function bar(y) {
+  return 1000 + callee(y);
+}
+var callee = function(y) { "use strict"; return y + 1; };
+
+%PrepareFunctionForOptimization(bar);
+%PrepareFunctionForOptimization(callee);
+assertEquals(1002, bar(1));
+assertEquals(1002, bar(1));
+
+%OptimizeMaglevOnNextCall(bar);
+assertEquals(1003, bar(2));
+callee = function(y) { "use strict"; return y + 2; };
+assertEquals(1004, bar(2));
+
+// A lazy deopt while the inlined function is on the stack resumes in the
+// inlined function's own frame, with its locals and parameters intact.
+// h uses a runtime call, which Maglev doesn't support yet, so it is called
+// rather than inlined.
+function h(y) {
+  if (y == 3) %DeoptimizeFunction(outer);
+  return y;
+}
+
+function inlinee(a, b) {
+  "use strict";
+  let t = a * 2;
+  let r = h(b);
+  return t + r + a;
+}
+
+function outer(a, b) {
+  return inlinee(a, b) + 1;
+}
+
+%PrepareFunctionForOptimization(inlinee);
+%PrepareFunctionForOptimization(outer);
+assertEquals(6, outer(1, 2));
+assertEquals(6, outer(1, 2));
+
+%OptimizeMaglevOnNextCall(outer);
+assertEquals(12, outer(3, 2));
+assertTrue(isMaglevved(outer));
+
+assertEquals(16, outer(4, 3));
+assertUnoptimized(outer);
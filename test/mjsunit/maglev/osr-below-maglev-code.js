@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --opt --use-osr --no-always-opt
+// Flags: --no-concurrent-osr --interrupt-budget=1024 --no-stress-opt
+
+// A frame that keeps looping in the interpreter after Maglev code for its
+// function became available requests Turbofan OSR at the next back edge of
+// any loop. The innermost loop below has the maximum OSR loop depth, so with
+// the regular urgency ramp (one loop level per tick) it would need six ticks
+// before it could OSR, more than its iterations take.
+
+function compileMaglev() {
+  %PrepareFunctionForOptimization(f);
+  %OptimizeMaglevOnNextCall(f);
+  f(0);
+}
+
+// Kept out of line: Maglev does not compile CallRuntime yet.
+function isTopmostFrameTurboFanned() {
+  return (%GetOptimizationStatus(f) &
+          V8OptimizationStatus.kTopmostFrameIsTurboFanned) != 0;
+}
+
+function f(n) {
+  if (n > 0) compileMaglev();
+  let osr_iteration = -1;
+  for (let a = 0; a < 1; a++) {
+    for (let b = 0; b < 1; b++) {
+      for (let c = 0; c < 1; c++) {
+        for (let d = 0; d < 1; d++) {
+          for (let e = 0; e < 1; e++) {
+            for (let i = 0; i < n; i++) {
+              if (osr_iteration < 0 && isTopmostFrameTurboFanned()) {
+                osr_iteration = i;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return osr_iteration;
+}
+
+const osr_iteration = f(100);
+assertTrue(isMaglevved(f));
+assertTrue(osr_iteration > 0);
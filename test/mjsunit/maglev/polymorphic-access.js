@@ -0,0 +1,189 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-stress-opt
+
+// Polymorphic loads, with the field at the same and at different offsets.
+function load(o) {
+  return o.x;
+}
+var a = {x: 1};
+var b = {x: 2, y: 0};
+var c = {y: 0, x: 3};
+
+%PrepareFunctionForOptimization(load);
+assertEquals(1, load(a));
+assertEquals(2, load(b));
+assertEquals(3, load(c));
+
+%OptimizeMaglevOnNextCall(load);
+assertEquals(1, load(a));
+assertEquals(2, load(b));
+assertEquals(3, load(c));
+assertTrue(isMaglevved(load));
+
+// An unseen map deopts.
+assertEquals(4, load({z: 0, x: 4}));
+assertUnoptimized(load);
+
+// Polymorphic stores.
+function store(o, v) {
+  o.x = v;
+}
+var d = {x: 1};
+var e = {y: 0, x: 2};
+
+%PrepareFunctionForOptimization(store);
+store(d, 10);
+store(e, 20);
+
+%OptimizeMaglevOnNextCall(store);
+store(d, 30);
+store(e, 40);
+assertEquals(30, d.x);
+assertEquals(40, e.x);
+assertTrue(isMaglevved(store));
+
+// Element loads and stores on packed Smi arrays. The stores to the literals
+// below copy their copy-on-write elements outside of the tested functions, so
+// their feedback is for standard stores.
+function loadSmi(a, i) {
+  return a[i];
+}
+function storeSmi(a, i, v) {
+  a[i] = v;
+}
+var smis = [1, 2, 3];
+smis[0] = 1;
+
+%PrepareFunctionForOptimization(loadSmi);
+%PrepareFunctionForOptimization(storeSmi);
+assertEquals(2, loadSmi(smis, 1));
+storeSmi(smis, 0, 4);
+
+%OptimizeMaglevOnNextCall(loadSmi);
+%OptimizeMaglevOnNextCall(storeSmi);
+assertEquals(3, loadSmi(smis, 2));
+storeSmi(smis, 1, 5);
+assertEquals([4, 5, 3], smis);
+assertTrue(isMaglevved(loadSmi));
+assertTrue(isMaglevved(storeSmi));
+
+// Loads from copy-on-write elements take the same fast path.
+var cow = [7, 8, 9];
+assertEquals(8, loadSmi(cow, 1));
+assertTrue(isMaglevved(loadSmi));
+
+// Stores to copy-on-write elements deopt, so the elements get copied.
+storeSmi(cow, 1, 10);
+assertEquals([7, 10, 9], cow);
+assertUnoptimized(storeSmi);
+
+// Out of bounds accesses deopt.
+assertEquals(undefined, loadSmi(smis, 3));
+assertUnoptimized(loadSmi);
+
+// Element loads and stores on packed object arrays.
+function loadObject(a, i) {
+  return a[i];
+}
+function storeObject(a, i, v) {
+  a[i] = v;
+}
+var objects = [{}, "a", 3];
+
+%PrepareFunctionForOptimization(loadObject);
+%PrepareFunctionForOptimization(storeObject);
+assertEquals("a", loadObject(objects, 1));
+storeObject(objects, 0, "b");
+
+%OptimizeMaglevOnNextCall(loadObject);
+%OptimizeMaglevOnNextCall(storeObject);
+assertEquals(3, loadObject(objects, 2));
+storeObject(objects, 1, "c");
+var object = {};
+storeObject(objects, 2, object);
+assertEquals(["b", "c", object], objects);
+assertSame(object, loadObject(objects, 2));
+assertTrue(isMaglevved(loadObject));
+assertTrue(isMaglevved(storeObject));
+
+var doubles = [1.5, 2.5, 3.5];
+
+function loadDouble(a, i) {
+  return a[i];
+}
+function storeDouble(a, i, v) {
+  a[i] = v;
+}
+%PrepareFunctionForOptimization(loadDouble);
+%PrepareFunctionForOptimization(storeDouble);
+assertEquals(1.5, loadDouble(doubles, 0));
+storeDouble(doubles, 0, 0.5);
+
+%OptimizeMaglevOnNextCall(loadDouble);
+%OptimizeMaglevOnNextCall(storeDouble);
+storeDouble(doubles, 1, 7);
+storeDouble(doubles, 2, NaN);
+assertEquals(0.5, loadDouble(doubles, 0));
+assertEquals(7, loadDouble(doubles, 1));
+assertEquals(NaN, loadDouble(doubles, 2));
+
+// Typed array element accesses.
+function loadTyped(a, i) {
+  return a[i];
+}
+function storeTyped(a, i, v) {
+  a[i] = v;
+}
+var int8 = new Int8Array(4);
+var uint16 = new Uint16Array(4);
+
+%PrepareFunctionForOptimization(loadTyped);
+%PrepareFunctionForOptimization(storeTyped);
+storeTyped(int8, 0, 1);
+assertEquals(1, loadTyped(int8, 0));
+
+%OptimizeMaglevOnNextCall(loadTyped);
+%OptimizeMaglevOnNextCall(storeTyped);
+storeTyped(int8, 1, 200);
+assertEquals(-56, loadTyped(int8, 1));
+storeTyped(int8, 2, -1);
+assertEquals(-1, loadTyped(int8, 2));
+assertTrue(isMaglevved(loadTyped));
+assertTrue(isMaglevved(storeTyped));
+
+// A different elements kind deopts.
+storeTyped(uint16, 0, 65535);
+assertEquals(65535, loadTyped(uint16, 0));
+assertUnoptimized(loadTyped);
+assertUnoptimized(storeTyped);
+
+// Untagged typed array element loads flowing into phis.
+function pickTyped(a, c) {
+  let x = 0;
+  if (c) x = a[1];
+  return x;
+}
+function lastTyped(a, n) {
+  let x = -1;
+  for (let i = 0; i < n; i++) x = a[i];
+  return x;
+}
+var int16 = new Int16Array([3, -4, 5]);
+
+%PrepareFunctionForOptimization(pickTyped);
+%PrepareFunctionForOptimization(lastTyped);
+assertEquals(-4, pickTyped(int16, true));
+assertEquals(0, pickTyped(int16, false));
+assertEquals(5, lastTyped(int16, 3));
+
+%OptimizeMaglevOnNextCall(pickTyped);
+%OptimizeMaglevOnNextCall(lastTyped);
+assertEquals(-4, pickTyped(int16, true));
+assertEquals(0, pickTyped(int16, false));
+assertEquals(-4, lastTyped(int16, 2));
+assertEquals(-1, lastTyped(int16, 0));
+assertTrue(isMaglevved(pickTyped));
+assertTrue(isMaglevved(lastTyped));
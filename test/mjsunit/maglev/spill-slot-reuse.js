@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-stress-opt
+
+function id(x) { return x; }
+
+// Values that die at different points, with calls in between forcing them to
+// be spilled, so that later values can reuse freed stack slots.
+function foo(a, b) {
+  let x = id(a) + b;
+  let y = id(x) + a;
+  let z = id(y) + x;
+  let w = id(z) + y;
+  let v = id(w) + z;
+  let u = id(v) + w;
+  return id(u) + v + a + b;
+}
+
+%PrepareFunctionForOptimization(id);
+%PrepareFunctionForOptimization(foo);
+const expected = foo(1, 2);
+assertEquals(expected, foo(1, 2));
+
+%OptimizeMaglevOnNextCall(foo);
+assertEquals(expected, foo(1, 2));
+assertEquals(foo(3, 4), foo(3, 4));
+
+// Values spilled and reused across loop iterations.
+function bar(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    let t = id(i) + 1;
+    let s = id(t) + i;
+    sum = id(sum) + s + t;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(bar);
+assertEquals(15, bar(3));
+assertEquals(15, bar(3));
+
+%OptimizeMaglevOnNextCall(bar);
+assertEquals(15, bar(3));
+assertEquals(155, bar(10));
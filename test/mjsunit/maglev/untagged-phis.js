@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-untagged-phis
+// Flags: --no-stress-opt
+
+function sum(n) {
+  let s = 0;
+  for (let i = 0; i < n; i = i + 1) {
+    s = s + i;
+  }
+  return s;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(45, sum(10));
+assertEquals(4950, sum(100));
+
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(45, sum(10));
+assertEquals(4950, sum(100));
+assertTrue(isMaglevved(sum));
+
+// The loop phi for s has a tagged use after the loop and stays tagged, so
+// only the Smi arithmetic on it can deopt.
+assertEquals(1249975000, sum(50000));
+
+// The phi for x at a forward merge only has int32 uses, so it is untagged.
+function select(c, a) {
+  let x;
+  if (c) {
+    x = a + 1;
+  } else {
+    x = a + 2;
+  }
+  return x + (x + 1);
+}
+
+%PrepareFunctionForOptimization(select);
+assertEquals(5, select(true, 1));
+assertEquals(7, select(false, 1));
+
+%OptimizeMaglevOnNextCall(select);
+assertEquals(5, select(true, 1));
+assertEquals(7, select(false, 1));
+assertTrue(isMaglevved(select));
@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <vector>
+
 #include "src/api/api-inl.h"
 #include "src/base/atomic-utils.h"
 #include "src/base/platform/semaphore.h"
@@ -15,6 +17,7 @@
 #include "src/heap/local-heap.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -63,6 +66,30 @@ class BlockingCompilationJob : public TurbofanCompilationJob {
   base::Semaphore semaphore_;
 };
 
+// A job that is only queued, never executed.
+class QueuedCompilationJob : public TurbofanCompilationJob {
+ public:
+  QueuedCompilationJob(Isolate* isolate, Handle<JSFunction> function,
+                       BytecodeOffset osr_offset)
+      : TurbofanCompilationJob(&info_, State::kReadyToExecute),
+        shared_(function->shared(), isolate),
+        zone_(isolate->allocator(), ZONE_NAME),
+        info_(&zone_, isolate, shared_, function, CodeKind::TURBOFAN,
+              osr_offset, nullptr) {}
+
+  Status PrepareJobImpl(Isolate* isolate) override { UNREACHABLE(); }
+  Status ExecuteJobImpl(RuntimeCallStats* stats,
+                        LocalIsolate* local_isolate) override {
+    UNREACHABLE();
+  }
+  Status FinalizeJobImpl(Isolate* isolate) override { UNREACHABLE(); }
+
+ private:
+  Handle<SharedFunctionInfo> shared_;
+  Zone zone_;
+  OptimizedCompilationInfo info_;
+};
+
 }  // namespace
 
 TEST_F(OptimizingCompileDispatcherTest, Construct) {
@@ -96,5 +123,56 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, NextInputOrder) {
+  Handle<JSFunction> small = RunJS<JSFunction>("(function small() {})");
+  Handle<JSFunction> large = RunJS<JSFunction>(
+      "(function large(a) { return a * a + a * a - a / (a + 1); })");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), small, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), large, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  ASSERT_LT(small->shared().GetBytecodeArray(i_isolate()).length(),
+            large->shared().GetBytecodeArray(i_isolate()).length());
+
+  QueuedCompilationJob small1(i_isolate(), small, BytecodeOffset::None());
+  QueuedCompilationJob large1(i_isolate(), large, BytecodeOffset::None());
+  QueuedCompilationJob small2(i_isolate(), small, BytecodeOffset::None());
+  QueuedCompilationJob small_osr(i_isolate(), small, BytecodeOffset(0));
+  std::vector<TurbofanCompilationJob*> queued = {&small1, &large1, &small2,
+                                                 &small_osr};
+
+  // Fill the input queue directly, since QueueForOptimization would start
+  // compiling the jobs on background threads.
+  auto dequeue_all = [&](OptimizingCompileDispatcher* dispatcher) {
+    for (TurbofanCompilationJob* job : queued) {
+      dispatcher->input_queue_[dispatcher->InputQueueIndex(
+          dispatcher->input_queue_length_++)] = job;
+    }
+    std::vector<TurbofanCompilationJob*> order;
+    while (TurbofanCompilationJob* job = dispatcher->NextInput(nullptr)) {
+      order.push_back(job);
+    }
+    return order;
+  };
+
+  // By default, jobs are compiled in FIFO order.
+  {
+    OptimizingCompileDispatcher dispatcher(i_isolate());
+    EXPECT_EQ(queued, dequeue_all(&dispatcher));
+  }
+
+  // Otherwise OSR jobs come first, then the largest job, and equally ranked
+  // jobs stay in FIFO order.
+  {
+    FlagScope<bool> largest_first(
+        &FLAG_concurrent_recompilation_largest_first, true);
+    OptimizingCompileDispatcher dispatcher(i_isolate());
+    std::vector<TurbofanCompilationJob*> expected = {&small_osr, &large1,
+                                                     &small1, &small2};
+    EXPECT_EQ(expected, dequeue_all(&dispatcher));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,143 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/bounds-check-elimination.h"
+
+#include "src/compiler/js-graph.h"
+#include "src/compiler/js-operator.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class BoundsCheckEliminationTest : public TypedGraphTest {
+ public:
+  BoundsCheckEliminationTest()
+      : TypedGraphTest(3),
+        simplified_(zone()),
+        javascript_(zone()),
+        machine_(zone()),
+        jsgraph_(isolate(), graph(), common(), &javascript_, &simplified_,
+                 &machine_) {}
+  ~BoundsCheckEliminationTest() override = default;
+
+ protected:
+  // A loop that counts from {start} up to {bound} and checks the counter
+  // against {length} in every iteration. If {exit_after_check} is set, the
+  // loop is also left after the check if parameter 2 is true.
+  struct Loop {
+    Node* effect_phi;
+    Node* check;
+  };
+
+  Loop NewLoop(Node* start_value, Node* bound, Node* length,
+               bool exit_after_check) {
+    Loop l;
+    Node* checkpoint = graph()->NewNode(common()->Checkpoint(),
+                                        EmptyFrameState(), start(), start());
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    l.effect_phi = graph()->NewNode(common()->EffectPhi(2), checkpoint,
+                                    checkpoint, loop);
+    Node* phi =
+        graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                         start_value, start_value, loop);
+    NodeProperties::SetType(phi, Type::UnsignedSmall());
+    Node* condition =
+        graph()->NewNode(simplified()->NumberLessThan(), phi, bound);
+    Node* branch = graph()->NewNode(common()->Branch(), condition, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    l.check = graph()->NewNode(simplified()->CheckBounds(FeedbackSource()),
+                               phi, length, l.effect_phi, if_true);
+    NodeProperties::SetType(l.check, Type::UnsignedSmall());
+    Node* add = graph()->NewNode(simplified()->NumberAdd(), phi,
+                                 NumberConstant(1));
+    NodeProperties::SetType(add, Type::UnsignedSmall());
+    phi->ReplaceInput(1, add);
+    l.effect_phi->ReplaceInput(1, l.check);
+
+    Node* zero = Int32Constant(0);
+    Node* ret =
+        graph()->NewNode(common()->Return(), zero, zero, l.effect_phi, if_false);
+    if (exit_after_check) {
+      Node* early_exit =
+          graph()->NewNode(common()->Branch(), Parameter(2), if_true);
+      loop->ReplaceInput(1, graph()->NewNode(common()->IfFalse(), early_exit));
+      Node* early_ret =
+          graph()->NewNode(common()->Return(), zero, zero, l.check,
+                           graph()->NewNode(common()->IfTrue(), early_exit));
+      graph()->SetEnd(graph()->NewNode(common()->End(2), ret, early_ret));
+    } else {
+      loop->ReplaceInput(1, if_true);
+      graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+    }
+    return l;
+  }
+
+  void RunBoundsCheckElimination() {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+    BoundsCheckElimination(&jsgraph_, loop_tree, zone()).Run();
+  }
+
+  Node* bound() { return Parameter(Type::UnsignedSmall(), 0); }
+  Node* length() { return Parameter(Type::UnsignedSmall(), 1); }
+
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  JSOperatorBuilder javascript_;
+  MachineOperatorBuilder machine_;
+  JSGraph jsgraph_;
+};
+
+TEST_F(BoundsCheckEliminationTest, EliminateCheckAgainstBound) {
+  Node* length = this->length();
+  Loop l = NewLoop(NumberConstant(0), length, length, false);
+  RunBoundsCheckElimination();
+  EXPECT_EQ(IrOpcode::kTypeGuard, l.check->opcode());
+  // No guard is needed in front of the loop.
+  EXPECT_EQ(IrOpcode::kCheckpoint,
+            NodeProperties::GetEffectInput(l.effect_phi, 0)->opcode());
+}
+
+TEST_F(BoundsCheckEliminationTest, GuardLoopWithOtherBound) {
+  Node* start_value = NumberConstant(0);
+  Node* bound = this->bound();
+  Node* length = this->length();
+  Loop l = NewLoop(start_value, bound, length, false);
+  RunBoundsCheckElimination();
+  EXPECT_EQ(IrOpcode::kTypeGuard, l.check->opcode());
+
+  // The loop is guarded by (bound <= max(start, length)).
+  Node* guard = NodeProperties::GetEffectInput(l.effect_phi, 0);
+  ASSERT_EQ(IrOpcode::kCheckIf, guard->opcode());
+  Node* in_bounds = NodeProperties::GetValueInput(guard, 0);
+  ASSERT_EQ(IrOpcode::kNumberLessThanOrEqual, in_bounds->opcode());
+  EXPECT_EQ(bound, NodeProperties::GetValueInput(in_bounds, 0));
+  Node* limit = NodeProperties::GetValueInput(in_bounds, 1);
+  ASSERT_EQ(IrOpcode::kNumberMax, limit->opcode());
+  EXPECT_EQ(start_value, NodeProperties::GetValueInput(limit, 0));
+  EXPECT_EQ(length, NodeProperties::GetValueInput(limit, 1));
+}
+
+TEST_F(BoundsCheckEliminationTest, KeepCheckInLoopWithEarlyExit) {
+  // The loop might be left before reaching an index out of bounds, so a guard
+  // in front of it could deoptimize although the loop would not.
+  Loop l = NewLoop(NumberConstant(0), bound(), length(), true);
+  RunBoundsCheckElimination();
+  EXPECT_EQ(IrOpcode::kCheckBounds, l.check->opcode());
+  EXPECT_EQ(IrOpcode::kCheckpoint,
+            NodeProperties::GetEffectInput(l.effect_phi, 0)->opcode());
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,125 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/escape-analysis.h"
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/all-nodes.h"
+#include "src/compiler/escape-analysis-reducer.h"
+#include "src/compiler/graph-reducer.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/js-operator.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/objects/fixed-array.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class EscapeAnalysisTest : public GraphTest {
+ public:
+  EscapeAnalysisTest()
+      : GraphTest(kMaxElements + 1),
+        simplified_(zone()),
+        javascript_(zone()),
+        machine_(zone()),
+        jsgraph_(isolate(), graph(), common(), &javascript_, &simplified_,
+                 &machine_) {}
+  ~EscapeAnalysisTest() override = default;
+
+ protected:
+  static constexpr int kMaxElements = 5;
+
+  // Allocates a FixedArray with {length} elements, initializes them with
+  // parameters and returns the element at the index given by the last
+  // parameter, which is in bounds.
+  Node* LoadFromNewArray(int length) {
+    DCHECK_LE(length, kMaxElements);
+    ElementAccess access = AccessBuilder::ForFixedArrayElement();
+    Node* begin = graph()->NewNode(
+        common()->BeginRegion(RegionObservability::kNotObservable), start());
+    Node* allocate = graph()->NewNode(
+        simplified()->Allocate(Type::Any(), AllocationType::kYoung),
+        jsgraph()->Constant(FixedArray::SizeFor(length)), begin, start());
+    Node* effect = allocate;
+    for (int i = 0; i < length; i++) {
+      effect = graph()->NewNode(simplified()->StoreElement(access), allocate,
+                                jsgraph()->Constant(i),
+                                Parameter(Type::Number(), i), effect, start());
+    }
+    Node* array =
+        graph()->NewNode(common()->FinishRegion(), allocate, effect);
+    Node* index = Parameter(Type::Range(0, length - 1, zone()), kMaxElements);
+    Node* load = graph()->NewNode(simplified()->LoadElement(access), array,
+                                  index, array, start());
+    NodeProperties::SetType(allocate, Type::OtherInternal());
+    NodeProperties::SetType(array, Type::OtherInternal());
+    NodeProperties::SetType(load, access.type);
+    Node* ret = graph()->NewNode(common()->Return(), jsgraph()->ZeroConstant(),
+                                 load, load, start());
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+    return ret;
+  }
+
+  void RunEscapeAnalysis() {
+    EscapeAnalysis escape_analysis(jsgraph(), tick_counter(), zone());
+    escape_analysis.ReduceGraph();
+    GraphReducer graph_reducer(zone(), graph(), tick_counter(), broker(),
+                               jsgraph()->Dead());
+    EscapeAnalysisReducer escape_reducer(&graph_reducer, jsgraph(), broker(),
+                                         escape_analysis.analysis_result(),
+                                         zone());
+    graph_reducer.AddReducer(&escape_reducer);
+    graph_reducer.ReduceGraph();
+  }
+
+  int CountLiveNodes(IrOpcode::Value opcode) {
+    AllNodes all(zone(), graph());
+    int count = 0;
+    for (Node* node : all.reachable) {
+      if (node->opcode() == opcode) count++;
+    }
+    return count;
+  }
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  JSOperatorBuilder javascript_;
+  MachineOperatorBuilder machine_;
+  JSGraph jsgraph_;
+};
+
+TEST_F(EscapeAnalysisTest, LoadElementAtVariableIndex) {
+  for (int length = 1; length <= 4; length++) {
+    Node* ret = LoadFromNewArray(length);
+    RunEscapeAnalysis();
+    // The array is scalar replaced and the load picks one of its elements.
+    EXPECT_EQ(0, CountLiveNodes(IrOpcode::kAllocate));
+    EXPECT_EQ(0, CountLiveNodes(IrOpcode::kLoadElement));
+    EXPECT_EQ(length - 1, CountLiveNodes(IrOpcode::kSelect));
+    Node* value = NodeProperties::GetValueInput(ret, 1);
+    if (length == 1) {
+      EXPECT_EQ(IrOpcode::kParameter, value->opcode());
+    } else {
+      EXPECT_EQ(IrOpcode::kSelect, value->opcode());
+    }
+  }
+}
+
+TEST_F(EscapeAnalysisTest, LoadElementAtVariableIndexFromLargerArray) {
+  LoadFromNewArray(5);
+  RunEscapeAnalysis();
+  EXPECT_EQ(1, CountLiveNodes(IrOpcode::kAllocate));
+  EXPECT_EQ(1, CountLiveNodes(IrOpcode::kLoadElement));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
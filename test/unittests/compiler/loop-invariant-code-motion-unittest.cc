@@ -0,0 +1,114 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopInvariantCodeMotionTest : public GraphTest {
+ public:
+  LoopInvariantCodeMotionTest() : GraphTest(3), simplified_(zone()) {}
+  ~LoopInvariantCodeMotionTest() override = default;
+
+ protected:
+  // A loop whose body performs {check} on the parameters 0 and 1. The loop
+  // exits if parameter 2 is false, either before or after the check.
+  struct Loop {
+    Node* loop;
+    Node* effect_phi;
+    Node* checkpoint;
+    Node* check;
+  };
+
+  Loop NewLoop(CheckBoundsFlags flags, bool exit_before_check) {
+    Loop l;
+    l.checkpoint = graph()->NewNode(common()->Checkpoint(), EmptyFrameState(),
+                                    start(), start());
+    l.loop = graph()->NewNode(common()->Loop(2), start(), start());
+    l.effect_phi = graph()->NewNode(common()->EffectPhi(2), l.checkpoint,
+                                    l.checkpoint, l.loop);
+    Node* branch;
+    if (exit_before_check) {
+      branch = graph()->NewNode(common()->Branch(), Parameter(2), l.loop);
+      Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+      l.check = graph()->NewNode(simplified()->CheckBounds(FeedbackSource(),
+                                                           flags),
+                                 Parameter(0), Parameter(1), l.effect_phi,
+                                 if_true);
+      l.loop->ReplaceInput(1, if_true);
+      InsertReturn(l.effect_phi, graph()->NewNode(common()->IfFalse(), branch));
+    } else {
+      l.check = graph()->NewNode(simplified()->CheckBounds(FeedbackSource(),
+                                                           flags),
+                                 Parameter(0), Parameter(1), l.effect_phi,
+                                 l.loop);
+      branch = graph()->NewNode(common()->Branch(), Parameter(2), l.loop);
+      l.loop->ReplaceInput(1, graph()->NewNode(common()->IfTrue(), branch));
+      InsertReturn(l.check, graph()->NewNode(common()->IfFalse(), branch));
+    }
+    l.effect_phi->ReplaceInput(1, l.check);
+    return l;
+  }
+
+  void InsertReturn(Node* effect, Node* control) {
+    Node* zero = graph()->NewNode(common()->Int32Constant(0));
+    Node* ret =
+        graph()->NewNode(common()->Return(), zero, zero, effect, control);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  void RunLoopInvariantCodeMotion() {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+    LoopInvariantCodeMotion(loop_tree, zone()).Run();
+  }
+
+  void ExpectHoisted(const Loop& l) {
+    EXPECT_EQ(l.checkpoint, NodeProperties::GetEffectInput(l.check));
+    EXPECT_EQ(start(), NodeProperties::GetControlInput(l.check));
+    EXPECT_EQ(l.check, NodeProperties::GetEffectInput(l.effect_phi, 0));
+  }
+
+  void ExpectNotHoisted(const Loop& l) {
+    EXPECT_EQ(l.effect_phi, NodeProperties::GetEffectInput(l.check));
+    EXPECT_EQ(l.checkpoint, NodeProperties::GetEffectInput(l.effect_phi, 0));
+  }
+
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+TEST_F(LoopInvariantCodeMotionTest, HoistCheckBeforeExit) {
+  Loop l = NewLoop({}, false);
+  RunLoopInvariantCodeMotion();
+  ExpectHoisted(l);
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepCheckAfterExit) {
+  // The loop might be left before the check is executed for the first time.
+  Loop l = NewLoop({}, true);
+  RunLoopInvariantCodeMotion();
+  ExpectNotHoisted(l);
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepAbortingCheckBounds) {
+  Loop l = NewLoop(CheckBoundsFlag::kAbortOnOutOfBounds, false);
+  RunLoopInvariantCodeMotion();
+  ExpectNotHoisted(l);
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,108 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-unrolling.h"
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/all-nodes.h"
+#include "src/compiler/common-operator.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class TypedArrayLoopUnrollerTest : public GraphTest {
+ public:
+  TypedArrayLoopUnrollerTest() : GraphTest(3), simplified_(zone()) {}
+  ~TypedArrayLoopUnrollerTest() override = default;
+
+ protected:
+  // Builds a loop with marked exits that counts from 0 to parameter 0 and
+  // loads the element at the loop variable in each iteration, either from a
+  // typed array or from a FixedArray.
+  void BuildLoop(bool typed_array) {
+    Node* zero = graph()->NewNode(common()->NumberConstant(0));
+    Node* one = graph()->NewNode(common()->NumberConstant(1));
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* phi = graph()->NewNode(
+        common()->Phi(MachineRepresentation::kTagged, 2), zero, zero, loop);
+    Node* cond =
+        graph()->NewNode(simplified()->NumberLessThan(), phi, Parameter(0));
+    Node* branch = graph()->NewNode(common()->Branch(), cond, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    Node* load;
+    if (typed_array) {
+      load = graph()->NewNode(
+          simplified()->LoadTypedElement(kExternalInt32Array), Parameter(1),
+          Parameter(1), Parameter(2), phi, effect_phi, if_true);
+    } else {
+      load = graph()->NewNode(
+          simplified()->LoadElement(AccessBuilder::ForFixedArrayElement()),
+          Parameter(1), phi, effect_phi, if_true);
+    }
+    Node* add = graph()->NewNode(simplified()->NumberAdd(), phi, one);
+    loop->ReplaceInput(1, if_true);
+    effect_phi->ReplaceInput(1, load);
+    phi->ReplaceInput(1, add);
+
+    Node* exit = graph()->NewNode(common()->LoopExit(), if_false, loop);
+    Node* exit_effect =
+        graph()->NewNode(common()->LoopExitEffect(), effect_phi, exit);
+    Node* ret = graph()->NewNode(common()->Return(), zero, zero, exit_effect,
+                                 exit);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  void RunTypedArrayLoopUnroller() {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+    TypedArrayLoopUnroller(graph(), common(), loop_tree, zone(),
+                           source_positions(), node_origins())
+        .UnrollInnerLoopsOfTree();
+  }
+
+  int CountLiveNodes(IrOpcode::Value opcode) {
+    AllNodes all(zone(), graph());
+    int count = 0;
+    for (Node* node : all.reachable) {
+      if (node->opcode() == opcode) count++;
+    }
+    return count;
+  }
+
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+TEST_F(TypedArrayLoopUnrollerTest, UnrollTypedArrayLoop) {
+  BuildLoop(true);
+  RunTypedArrayLoopUnroller();
+  // The loop is small enough for the maximal unrolling count, and every
+  // iteration keeps its own exit.
+  const int iterations = TypedArrayLoopUnroller::kMaxUnrollingCount + 1;
+  EXPECT_EQ(iterations, CountLiveNodes(IrOpcode::kLoadTypedElement));
+  EXPECT_EQ(iterations, CountLiveNodes(IrOpcode::kBranch));
+  EXPECT_EQ(iterations, CountLiveNodes(IrOpcode::kLoopExit));
+  EXPECT_EQ(1, CountLiveNodes(IrOpcode::kLoop));
+}
+
+TEST_F(TypedArrayLoopUnrollerTest, KeepLoopWithoutTypedArrayAccess) {
+  BuildLoop(false);
+  RunTypedArrayLoopUnroller();
+  EXPECT_EQ(1, CountLiveNodes(IrOpcode::kLoadElement));
+  EXPECT_EQ(1, CountLiveNodes(IrOpcode::kBranch));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
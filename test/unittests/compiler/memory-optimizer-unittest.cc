@@ -0,0 +1,109 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/memory-optimizer.h"
+
+#include "src/compiler/all-nodes.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/js-operator.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class MemoryOptimizerTest : public GraphTest {
+ public:
+  MemoryOptimizerTest()
+      : GraphTest(1),
+        simplified_(zone()),
+        javascript_(zone()),
+        machine_(zone()),
+        jsgraph_(isolate(), graph(), common(), &javascript_, &simplified_,
+                 &machine_) {}
+  ~MemoryOptimizerTest() override = default;
+
+ protected:
+  Node* AllocateRaw(int size, Node* effect, Node* control) {
+    return graph()->NewNode(simplified()->AllocateRaw(Type::Any()),
+                            jsgraph()->IntPtrConstant(size), effect, control);
+  }
+
+  // Allocates 16 bytes, then 16 or 32 bytes depending on parameter 0, and
+  // another 16 bytes after the merge of both branches.
+  void BuildAllocationsAroundMerge() {
+    Node* first = AllocateRaw(16, start(), start());
+    Node* branch = graph()->NewNode(common()->Branch(), Parameter(0), first);
+    Node* if_true = AllocateRaw(
+        16, first, graph()->NewNode(common()->IfTrue(), branch));
+    Node* if_false = AllocateRaw(
+        32, first, graph()->NewNode(common()->IfFalse(), branch));
+    Node* merge = graph()->NewNode(common()->Merge(2), if_true, if_false);
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), if_true, if_false, merge);
+    Node* last = AllocateRaw(16, effect_phi, merge);
+    Node* ret = graph()->NewNode(common()->Return(), jsgraph()->ZeroConstant(),
+                                 last, last, last);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  void RunMemoryOptimizer() {
+    MemoryOptimizer(jsgraph(), zone(),
+                    MemoryLowering::AllocationFolding::kDoAllocationFolding,
+                    "test", tick_counter())
+        .Optimize();
+  }
+
+  // Each allocation group checks the limit once and calls the allocation
+  // stub with its reservation size if the check fails.
+  std::vector<Node*> AllocationStubCalls() {
+    std::vector<Node*> calls;
+    for (Node* node : AllNodes(zone(), graph()).reachable) {
+      if (node->opcode() == IrOpcode::kCall) calls.push_back(node);
+    }
+    return calls;
+  }
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  JSOperatorBuilder javascript_;
+  MachineOperatorBuilder machine_;
+  JSGraph jsgraph_;
+};
+
+TEST_F(MemoryOptimizerTest, FoldAllocationsAcrossMerge) {
+  FlagScope<bool> fold_across_merges(
+      &FLAG_turbo_allocation_folding_across_merges, true);
+  BuildAllocationsAroundMerge();
+  RunMemoryOptimizer();
+
+  // All four allocations share a single group, which reserves the size of
+  // the larger branch.
+  std::vector<Node*> calls = AllocationStubCalls();
+  ASSERT_EQ(1u, calls.size());
+  IntPtrMatcher reservation(calls[0]->InputAt(1));
+  ASSERT_TRUE(reservation.HasResolvedValue());
+  EXPECT_EQ(16 + 32 + 16, reservation.ResolvedValue());
+}
+
+TEST_F(MemoryOptimizerTest, CloseGroupAtMergeWithoutFlag) {
+  FlagScope<bool> fold_across_merges(
+      &FLAG_turbo_allocation_folding_across_merges, false);
+  BuildAllocationsAroundMerge();
+  RunMemoryOptimizer();
+
+  // The allocation after the merge starts a new group.
+  EXPECT_EQ(2u, AllocationStubCalls().size());
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -23,6 +23,13 @@ class CompactableCustomSpace : public CustomSpace<CompactableCustomSpace> {
   static constexpr bool kSupportsCompaction = true;
 };
 
+class OtherCompactableCustomSpace
+    : public CustomSpace<OtherCompactableCustomSpace> {
+ public:
+  static constexpr size_t kSpaceIndex = 1;
+  static constexpr bool kSupportsCompaction = true;
+};
+
 namespace internal {
 
 namespace {
@@ -41,13 +48,15 @@ struct CompactableGCed : public GarbageCollected<CompactableGCed> {
 // static
 size_t CompactableGCed::g_destructor_callcount = 0;
 
-template <int kNumObjects>
+struct OtherCompactableGCed : public CompactableGCed {};
+
+template <int kNumObjects, typename ObjectType = CompactableGCed>
 struct CompactableHolder
-    : public GarbageCollected<CompactableHolder<kNumObjects>> {
+    : public GarbageCollected<CompactableHolder<kNumObjects, ObjectType>> {
  public:
   explicit CompactableHolder(cppgc::AllocationHandle& allocation_handle) {
     for (int i = 0; i < kNumObjects; ++i)
-      objects[i] = MakeGarbageCollected<CompactableGCed>(allocation_handle);
+      objects[i] = MakeGarbageCollected<ObjectType>(allocation_handle);
   }
 
   void Trace(Visitor* visitor) const {
@@ -65,6 +74,8 @@ class CompactorTest : public testing::TestWithPlatform {
     Heap::HeapOptions options;
     options.custom_spaces.emplace_back(
         std::make_unique<CompactableCustomSpace>());
+    options.custom_spaces.emplace_back(
+        std::make_unique<OtherCompactableCustomSpace>());
     heap_ = Heap::Create(platform_, std::move(options));
   }
 
@@ -116,6 +127,11 @@ struct SpaceTrait<internal::CompactableGCed> {
   using Space = CompactableCustomSpace;
 };
 
+template <>
+struct SpaceTrait<internal::OtherCompactableGCed> {
+  using Space = OtherCompactableCustomSpace;
+};
+
 namespace internal {
 
 TEST_F(CompactorTest, NothingToCompact) {
@@ -241,5 +257,47 @@ TEST_F(CompactorTest, InteriorSlotToNextObject) {
   EXPECT_EQ(references[1], holder->objects[1]->other);
 }
 
+TEST_F(CompactorTest, BudgetLimitsCompactedSpacesPerCycle) {
+  static constexpr int kNumObjects = 10;
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  Persistent<CompactableHolder<kNumObjects, OtherCompactableGCed>>
+      other_holder = MakeGarbageCollected<
+          CompactableHolder<kNumObjects, OtherCompactableGCed>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  CompactableGCed* references[kNumObjects] = {nullptr};
+  CompactableGCed* other_references[kNumObjects] = {nullptr};
+  for (int i = 0; i < kNumObjects; ++i) {
+    references[i] = holder->objects[i];
+    other_references[i] = other_holder->objects[i];
+  }
+  // A budget of zero still compacts a single space per cycle.
+  compactor().SetCompactionBudgetPerCycle(0);
+  StartGC();
+  for (int i = 0; i < kNumObjects; i += 2) {
+    holder->objects[i] = nullptr;
+    other_holder->objects[i] = nullptr;
+  }
+  EndGC();
+  EXPECT_EQ(10u, CompactableGCed::g_destructor_callcount);
+  bool compacted = true;
+  bool other_compacted = true;
+  for (int i = 1; i < kNumObjects; i += 2) {
+    compacted &= holder->objects[i] == references[i / 2];
+    other_compacted &= other_holder->objects[i] == other_references[i / 2];
+  }
+  // Exactly one of the spaces has been compacted. The other one has been
+  // swept and its objects remain in place.
+  EXPECT_NE(compacted, other_compacted);
+  CompactableGCed* const* swept_references =
+      compacted ? other_references : references;
+  const auto& swept_objects =
+      compacted ? other_holder->objects : holder->objects;
+  for (int i = 1; i < kNumObjects; i += 2) {
+    EXPECT_EQ(swept_references[i], swept_objects[i]);
+  }
+}
+
 }  // namespace internal
 }  // namespace cppgc
@@ -0,0 +1,69 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifdef V8_ENABLE_MAGLEV
+
+#include "src/maglev/maglev-concurrent-dispatcher.h"
+
+#include <vector>
+
+#include "src/codegen/compiler.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+using MaglevConcurrentDispatcherTest = TestWithNativeContext;
+
+TEST_F(MaglevConcurrentDispatcherTest, IncomingQueueOrder) {
+  FlagScope<bool> maglev(&FLAG_maglev, true);
+  Handle<JSFunction> function = RunJS<JSFunction>("(function f() {})");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), function,
+                                Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  JSFunction::EnsureFeedbackVector(i_isolate(), function, &is_compiled_scope);
+
+  std::vector<std::unique_ptr<MaglevCompilationJob>> jobs;
+  for (int i = 0; i < 4; i++) {
+    jobs.push_back(MaglevCompilationJob::New(i_isolate(), function));
+  }
+  std::vector<MaglevCompilationJob*> cold = {jobs[0].get(), jobs[2].get()};
+  std::vector<MaglevCompilationJob*> hot = {jobs[1].get(), jobs[3].get()};
+
+  // Fill the incoming queue directly, since EnqueueJob would start compiling
+  // the jobs on background threads.
+  MaglevConcurrentDispatcher::IncomingQueue queue;
+  EXPECT_TRUE(queue.IsEmpty());
+  queue.Enqueue(std::move(jobs[0]), 1);
+  queue.Enqueue(std::move(jobs[1]), 5);
+  queue.Enqueue(std::move(jobs[2]), 1);
+  queue.Enqueue(std::move(jobs[3]), 5);
+  EXPECT_EQ(4u, queue.size());
+
+  // Hotter jobs come first, and equally hot jobs stay in FIFO order.
+  std::vector<MaglevCompilationJob*> expected = {hot[0], hot[1], cold[0],
+                                                 cold[1]};
+  std::vector<MaglevCompilationJob*> order;
+  std::unique_ptr<MaglevCompilationJob> job;
+  while (queue.Dequeue(&job)) {
+    order.push_back(job.get());
+    jobs.push_back(std::move(job));
+  }
+  EXPECT_EQ(expected, order);
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ENABLE_MAGLEV